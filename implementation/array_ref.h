@@ -20,19 +20,26 @@
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
 #include <atomic>
+#include <cassert>
 #include <cstddef>
 #include <type_traits>
 
 #include "implementation/array_view.h"
 #include "implementation/class_ref.h"
+#include "implementation/critical_array_view.h"
 #include "implementation/forward_declarations.h"
 #include "implementation/jni_helper/jni_array_helper.h"
 #include "implementation/jni_helper/lifecycle.h"
 #include "implementation/local_object.h"
 #include "implementation/no_idx.h"
 #include "implementation/promotion_mechanics_tags.h"
+#include "implementation/tracked_array_view.h"
 #include "jni_dep.h"
 
+#if __cplusplus >= 202002L
+#include <span>
+#endif  // __cplusplus >= 202002L
+
 namespace jni {
 
 // Note: All arrays are local (global arrays of local objects is too confusing).
@@ -59,6 +66,39 @@ class ArrayRef : public ScopedArrayImpl<JniT> {
     return {Base::object_ref_, copy_on_completion, Length()};
   }
 
+  // Like `Pin`, but read only and never copied back.
+  ConstArrayView<SpanType> PinConst() { return {Base::object_ref_, Length()}; }
+
+  // Like `Pin`, but only the elements written through the view are copied
+  // back (see `TrackedArrayView`).
+  TrackedArrayView<SpanType> PinTracked() {
+    return {Base::object_ref_, Length()};
+  }
+
+  // Like `Pin`, but avoids the copy most VMs make for `Pin`. No other JNI call
+  // may be made while the returned view is alive (see `CriticalArrayView`).
+  CriticalArrayView<SpanType> PinCritical(bool copy_on_completion = true) {
+    return {Base::object_ref_, copy_on_completion, Length()};
+  }
+
+#if __cplusplus >= 202002L
+  // Copies `out.size()` elements starting at `offset` into `out`. Unlike `Pin`
+  // this only ever copies the elements requested, so it is preferable for
+  // small accesses to large arrays.
+  void CopyTo(std::size_t offset, std::span<SpanType> out) {
+    assert(offset <= Length() && out.size() <= Length() - offset);
+    JniArrayHelper<SpanType, JniT::kRank>::GetArrayRegion(
+        Base::object_ref_, offset, out.size(), out.data());
+  }
+
+  // Copies `in` into the array starting at `offset`.
+  void CopyFrom(std::size_t offset, std::span<const SpanType> in) {
+    assert(offset <= Length() && in.size() <= Length() - offset);
+    JniArrayHelper<SpanType, JniT::kRank>::SetArrayRegion(
+        Base::object_ref_, offset, in.size(), in.data());
+  }
+#endif  // __cplusplus >= 202002L
+
   std::size_t Length() {
     if (length_.load() == kNoIdx) {
       length_.store(
@@ -29,6 +29,10 @@
 #include "implementation/jni_helper/lifecycle.h"
 #include "jni_dep.h"
 
+#if __cplusplus >= 202002L
+#include <span>
+#endif  // __cplusplus >= 202002L
+
 namespace jni {
 
 struct ArrayViewHelperBase {};
@@ -48,48 +52,9 @@ class ArrayView {
  public:
   using SpanType = SpanType_;
 
-  struct Iterator {
-    using iterator_category = std::random_access_iterator_tag;
-    using difference_type = std::size_t;
-    using value_type = SpanType;
-    using pointer = SpanType*;
-    using reference = SpanType&;
-
-    Iterator(SpanType* ptr, std::size_t size, std::size_t idx)
-        : size_(size), ptr_(ptr), idx_(idx) {}
-
-    Iterator& operator++() {
-      idx_++;
-      return *this;
-    }
-
-    Iterator operator++(int) {
-      Iterator tmp = *this;
-      ++(*this);
-      return tmp;
-    }
-
-    SpanType& operator*() const { return ptr_[idx_]; }
-    const SpanType* operator->() const { return ptr_[idx_]; }
-
-    friend bool operator==(const Iterator& lhs, const Iterator& rhs) {
-      return (lhs.ptr_ == rhs.ptr_) && (lhs.size_ == rhs.size_) &&
-             (lhs.idx_ == rhs.idx_);
-    };
-
-    friend bool operator!=(const Iterator& lhs, const Iterator& rhs) {
-      return !(lhs == rhs);
-    };
-
-    friend std::size_t operator-(const Iterator& lhs, const Iterator& rhs) {
-      return lhs.idx_ - rhs.idx_;
-    };
-
-   private:
-    const std::size_t size_;
-    SpanType* const ptr_;
-    std::size_t idx_;
-  };
+  // Primitive arrays are contiguous, so raw pointers are the iterators. This
+  // lets standard algorithms (and the optimizer) treat a view as plain memory.
+  using Iterator = SpanType*;
 
   ArrayView(ArrayView&&) = delete;
   ArrayView(const ArrayView&) = delete;
@@ -111,11 +76,17 @@ class ArrayView {
     return get_array_elements_result_.ptr_;
   }
 
+  SpanType* data() const { return ptr(); }
+
   // Arrays of rank > 1 are object arrays which are not contiguous.
   std::size_t size() const { return size_; }
 
-  Iterator begin() const { return Iterator{ptr(), size_, 0}; }
-  Iterator end() const { return Iterator{ptr(), size_, size_}; }
+  Iterator begin() const { return ptr(); }
+  Iterator end() const { return ptr() + size_; }
+
+#if __cplusplus >= 202002L
+  operator std::span<SpanType>() const { return {ptr(), size_}; }
+#endif  // __cplusplus >= 202002L
 
  protected:
   const jarray array_;
@@ -124,6 +95,28 @@ class ArrayView {
   const std::size_t size_;
 };
 
+// A read only view of a primitive array. The buffer is always released with
+// `JNI_ABORT`, so nothing is ever copied back.
+template <typename SpanType>
+class ConstArrayView {
+ public:
+  ConstArrayView(jarray array, std::size_t size) : view_(array, false, size) {}
+
+  const SpanType* ptr() const { return view_.ptr(); }
+  const SpanType* data() const { return view_.ptr(); }
+  std::size_t size() const { return view_.size(); }
+
+  const SpanType* begin() const { return ptr(); }
+  const SpanType* end() const { return ptr() + size(); }
+
+#if __cplusplus >= 202002L
+  operator std::span<const SpanType>() const { return {ptr(), size()}; }
+#endif  // __cplusplus >= 202002L
+
+ private:
+  const ArrayView<SpanType, 1> view_;
+};
+
 // Metafunction that returns the type after a single dereference.
 template <typename SpanType, std::size_t>
 struct PinHelper {
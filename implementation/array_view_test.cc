@@ -15,6 +15,10 @@
  */
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -22,21 +26,31 @@
 #include "jni_bind.h"
 #include "jni_test.h"
 
+#if __cplusplus >= 202002L
+#include <span>
+#endif  // __cplusplus >= 202002L
+
 namespace {
 
 using ::jni::AdoptLocal;
 using ::jni::ArrayView;
 using ::jni::CDecl_t;
 using ::jni::Class;
+using ::jni::ConstArrayView;
+using ::jni::CriticalArrayView;
+using ::jni::CriticalArrayViewBase;
 using ::jni::Fake;
+using ::jni::JniEnv;
 using ::jni::LocalArray;
 using ::jni::LocalObject;
 using ::jni::Method;
 using ::jni::Return;
+using ::jni::TrackedArrayView;
 using ::jni::test::AsNewLocalReference;
 using ::jni::test::JniTest;
 using ::testing::_;
 using ::testing::Eq;
+using ::testing::SetArgPointee;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Pin Tests.
@@ -280,6 +294,249 @@ TEST_F(JniTest, ArrayView_DoubleIsIterable) {
                          fake_vals.end()));
 }
 
+TEST_F(JniTest, ArrayView_PrimitiveIteratorsArePointers) {
+  std::array fake_vals{jfloat{1}, jfloat{2}, jfloat{3}};
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jfloatArray>()))
+      .WillOnce(::testing::Return(3));
+  EXPECT_CALL(*env_, GetFloatArrayElements)
+      .WillOnce(::testing::Return(fake_vals.data()));
+
+  LocalArray<jfloat> float_arr{AdoptLocal{}, Fake<jfloatArray>()};
+  ArrayView<jfloat, 1> float_view = float_arr.Pin();
+
+  static_assert(std::is_same_v<decltype(float_view.begin()), jfloat*>);
+  EXPECT_EQ(float_view.data(), fake_vals.data());
+  EXPECT_EQ(float_view.end() - float_view.begin(), 3);
+  EXPECT_EQ(std::accumulate(float_view.begin(), float_view.end(), jfloat{0}),
+            6.f);
+
+#if __cplusplus >= 202002L
+  static_assert(std::contiguous_iterator<ArrayView<jfloat, 1>::Iterator>);
+
+  std::span<jfloat> float_span = float_view;
+  EXPECT_EQ(float_span.data(), fake_vals.data());
+  EXPECT_EQ(float_span.size(), 3);
+#endif  // __cplusplus >= 202002L
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Const and Tracked Pin Tests.
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(JniTest, ConstArrayView_IsReadOnlyAndNeverCopiesBack) {
+  std::array fake_vals{jint{1}, jint{2}, jint{3}};
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jintArray>()))
+      .WillOnce(::testing::Return(3));
+  EXPECT_CALL(*env_, GetIntArrayElements(Eq(Fake<jintArray>()), _))
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_, ReleaseIntArrayElements(Eq(Fake<jintArray>()),
+                                             Eq(fake_vals.data()), JNI_ABORT));
+
+  LocalArray<jint> int_arr{AdoptLocal{}, Fake<jintArray>()};
+  ConstArrayView<jint> int_view = int_arr.PinConst();
+
+  static_assert(std::is_same_v<decltype(int_view.ptr()), const jint*>);
+  EXPECT_TRUE(std::equal(int_view.begin(), int_view.end(), fake_vals.begin(),
+                         fake_vals.end()));
+}
+
+TEST_F(JniTest, TrackedArrayView_CopiesBackOnlyDirtyRanges) {
+  std::array<jint, 8> fake_vals{};
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jintArray>()))
+      .WillOnce(::testing::Return(8));
+  EXPECT_CALL(*env_, GetIntArrayElements(Eq(Fake<jintArray>()), _))
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_, SetIntArrayRegion(Eq(Fake<jintArray>()), 1, 3,
+                                       Eq(fake_vals.data() + 1)));
+  EXPECT_CALL(*env_, SetIntArrayRegion(Eq(Fake<jintArray>()), 6, 1,
+                                       Eq(fake_vals.data() + 6)));
+  EXPECT_CALL(*env_, ReleaseIntArrayElements(Eq(Fake<jintArray>()),
+                                             Eq(fake_vals.data()), JNI_ABORT));
+
+  LocalArray<jint> int_arr{AdoptLocal{}, Fake<jintArray>()};
+  {
+    TrackedArrayView<jint> int_view = int_arr.PinTracked();
+    int_view.Set(6, 60);
+    int_view.Set(2, 20);
+    int_view.MutableRange(1, 2)[0] = 10;
+    int_view.Set(3, 30);
+
+    EXPECT_EQ(int_view.ptr()[2], 20);
+  }
+
+  EXPECT_EQ(fake_vals[1], 10);
+  EXPECT_EQ(fake_vals[6], 60);
+}
+
+TEST_F(JniTest, TrackedArrayView_CopiesNothingBackIfUnwritten) {
+  std::array fake_vals{jdouble{1}, jdouble{2}};
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jdoubleArray>()))
+      .WillOnce(::testing::Return(2));
+  EXPECT_CALL(*env_, GetDoubleArrayElements)
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_, SetDoubleArrayRegion).Times(0);
+  EXPECT_CALL(*env_,
+              ReleaseDoubleArrayElements(Eq(Fake<jdoubleArray>()),
+                                         Eq(fake_vals.data()), JNI_ABORT));
+
+  LocalArray<jdouble> double_arr{AdoptLocal{}, Fake<jdoubleArray>()};
+  TrackedArrayView<jdouble> double_view = double_arr.PinTracked();
+}
+
+TEST_F(JniTest, TrackedArrayView_SkipsCopyBackIfVmDidNotCopy) {
+  std::array fake_vals{jint{1}, jint{2}};
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jintArray>()))
+      .WillOnce(::testing::Return(2));
+  EXPECT_CALL(*env_, GetIntArrayElements)
+      .WillOnce(::testing::DoAll(SetArgPointee<1>(JNI_FALSE),
+                                 ::testing::Return(fake_vals.data())));
+  EXPECT_CALL(*env_, SetIntArrayRegion).Times(0);
+
+  LocalArray<jint> int_arr{AdoptLocal{}, Fake<jintArray>()};
+  TrackedArrayView<jint> int_view = int_arr.PinTracked();
+  int_view.Set(0, 5);
+}
+
+TEST_F(JniTest, TrackedArrayView_CopiesEverythingBackPastTheRangeLimit) {
+  std::array<jint, 64> fake_vals{};
+
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(64));
+  EXPECT_CALL(*env_, GetIntArrayElements)
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_, SetIntArrayRegion).Times(0);
+  EXPECT_CALL(*env_, ReleaseIntArrayElements(Eq(Fake<jintArray>()),
+                                             Eq(fake_vals.data()), 0));
+
+  LocalArray<jint> int_arr{AdoptLocal{}, Fake<jintArray>()};
+  TrackedArrayView<jint> int_view = int_arr.PinTracked();
+  for (std::size_t i = 0; i < 2 * (jni::kTrackedArrayMaxRanges + 1); i += 2) {
+    int_view.Set(i, 1);
+  }
+}
+
+TEST_F(JniTest, TrackedArrayView_CopiesEverythingBackIfMostlyWritten) {
+  std::array<jint, 8> fake_vals{};
+
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(8));
+  EXPECT_CALL(*env_, GetIntArrayElements)
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_, SetIntArrayRegion).Times(0);
+  EXPECT_CALL(*env_, ReleaseIntArrayElements(Eq(Fake<jintArray>()),
+                                             Eq(fake_vals.data()), 0));
+
+  LocalArray<jint> int_arr{AdoptLocal{}, Fake<jintArray>()};
+  TrackedArrayView<jint> int_view = int_arr.PinTracked();
+  std::fill_n(int_view.MutableRange(0, 5), 5, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Critical Pin Tests.
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(JniTest, CriticalArrayView_GetsAndReleasesCriticalBuffer) {
+  std::array fake_vals{jint{1}, jint{2}, jint{3}};
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jintArray>()))
+      .WillOnce(::testing::Return(3));
+  EXPECT_CALL(*env_, GetIntArrayElements).Times(0);
+  EXPECT_CALL(*env_, GetPrimitiveArrayCritical(Eq(Fake<jintArray>()), _))
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_, ReleasePrimitiveArrayCritical(
+                         Eq(Fake<jintArray>()), Eq(fake_vals.data()), 0));
+
+  LocalArray<jint> int_arr{AdoptLocal{}, Fake<jintArray>()};
+  CriticalArrayView<jint> int_view = int_arr.PinCritical();
+
+  EXPECT_EQ(int_view.size(), 3);
+  EXPECT_TRUE(std::equal(int_view.begin(), int_view.end(), fake_vals.begin(),
+                         fake_vals.end()));
+}
+
+TEST_F(JniTest, CriticalArrayView_ReleasesWithAbortWhenNotCopying) {
+  std::array fake_vals{jfloat{1}, jfloat{2}};
+
+  EXPECT_CALL(*env_, GetArrayLength(Fake<jfloatArray>()))
+      .WillOnce(::testing::Return(2));
+  EXPECT_CALL(*env_, GetPrimitiveArrayCritical(Eq(Fake<jfloatArray>()), _))
+      .WillOnce(::testing::Return(fake_vals.data()));
+  EXPECT_CALL(*env_,
+              ReleasePrimitiveArrayCritical(Eq(Fake<jfloatArray>()),
+                                            Eq(fake_vals.data()), JNI_ABORT));
+
+  LocalArray<jfloat> float_arr{AdoptLocal{}, Fake<jfloatArray>()};
+  CriticalArrayView<jfloat> float_view = float_arr.PinCritical(false);
+}
+
+#ifndef NDEBUG
+TEST_F(JniTest, CriticalArrayView_CountsRegions) {
+  std::array fake_vals{jbyte{1}};
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(::testing::Return(1));
+  EXPECT_CALL(*env_, GetPrimitiveArrayCritical)
+      .WillRepeatedly(::testing::Return(fake_vals.data()));
+
+  std::size_t count_before = CriticalArrayViewBase::GetStats().count;
+
+  LocalArray<jbyte> byte_arr{AdoptLocal{}, Fake<jbyteArray>()};
+  { CriticalArrayView<jbyte> view = byte_arr.PinCritical(); }
+  { CriticalArrayView<jbyte> view = byte_arr.PinCritical(); }
+
+  auto stats = CriticalArrayViewBase::GetStats();
+  EXPECT_EQ(stats.count, count_before + 2);
+  EXPECT_LE(stats.max_duration, stats.total_duration);
+}
+#endif  // NDEBUG
+
+TEST_F(JniTest, CriticalArrayView_FailedPinsAreEmptyAndNotReleased) {
+  EXPECT_CALL(*env_, GetArrayLength).WillRepeatedly(::testing::Return(3));
+  EXPECT_CALL(*env_, GetPrimitiveArrayCritical)
+      .WillOnce(::testing::Return(nullptr));
+  EXPECT_CALL(*env_, ReleasePrimitiveArrayCritical).Times(0);
+
+  LocalArray<jint> int_arr{AdoptLocal{}, Fake<jintArray>()};
+  std::size_t calls_before = JniEnv::CallsInCriticalRegion().load();
+  std::size_t regions_before = CriticalArrayViewBase::GetStats().count;
+
+  {
+    CriticalArrayView<jint> view = int_arr.PinCritical();
+    EXPECT_EQ(view.ptr(), nullptr);
+    EXPECT_EQ(view.size(), 0);
+    EXPECT_EQ(view.begin(), view.end());
+
+    // No region was opened, so further calls are allowed.
+    int_arr.Length();
+  }
+
+  EXPECT_EQ(JniEnv::CallsInCriticalRegion().load(), calls_before);
+  EXPECT_EQ(CriticalArrayViewBase::GetStats().count, regions_before);
+}
+
+#ifndef NDEBUG
+TEST_F(JniTest, CriticalArrayView_FlagsJniCallsInsideTheRegion) {
+  std::array fake_vals{jint{1}};
+  EXPECT_CALL(*env_, GetArrayLength).WillRepeatedly(::testing::Return(1));
+  EXPECT_CALL(*env_, GetPrimitiveArrayCritical)
+      .WillOnce(::testing::Return(fake_vals.data()));
+
+  LocalArray<jint> int_arr{AdoptLocal{}, Fake<jintArray>(1)};
+  LocalArray<jint> other_arr{AdoptLocal{}, Fake<jintArray>(2)};
+  std::size_t calls_before = JniEnv::CallsInCriticalRegion().load();
+
+  {
+    CriticalArrayView<jint> view = int_arr.PinCritical();
+    EXPECT_EQ(JniEnv::CallsInCriticalRegion().load(), calls_before);
+
+    other_arr.Length();
+    EXPECT_EQ(JniEnv::CallsInCriticalRegion().load(), calls_before + 1);
+  }
+
+  LocalArray<jint>{AdoptLocal{}, Fake<jintArray>(3)}.Length();
+  EXPECT_EQ(JniEnv::CallsInCriticalRegion().load(), calls_before + 1);
+}
+#endif  // NDEBUG
+
 ////////////////////////////////////////////////////////////////////////////////
 // Iteration Tests: Objects.
 ////////////////////////////////////////////////////////////////////////////////
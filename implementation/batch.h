@@ -0,0 +1,312 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_IMPLEMENTATION_BATCH_H_
+#define JNI_BIND_IMPLEMENTATION_BATCH_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "class_defs/java_lang_classes.h"
+#include "class_defs/java_nio_classes.h"
+#include "implementation/bound_method.h"
+#include "implementation/call_checked.h"
+#include "implementation/class.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/global_object.h"
+#include "implementation/global_string.h"
+#include "implementation/id.h"
+#include "implementation/id_type.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_helper/jvalue.h"
+#include "implementation/jni_type.h"
+#include "implementation/jvm.h"
+#include "implementation/method.h"
+#include "implementation/no_idx.h"
+#include "implementation/params.h"
+#include "implementation/promotion_mechanics_tags.h"
+#include "implementation/ref_base.h"
+#include "implementation/return.h"
+#include "implementation/signature.h"
+#include "implementation/static.h"
+#include "implementation/static_ref.h"
+#include "jni_dep.h"
+#include "metaprogramming/string_literal.h"
+
+namespace jni {
+
+#if __cplusplus >= 202002L
+// Java counterpart of `Batch`, see "java/com/jnibind/BatchExecutor.java".
+// clang-format off
+inline constexpr Class kBatchExecutorClass{
+    "com/jnibind/BatchExecutor",
+    Static{
+        Method{"execute", Return{},
+               Params{kJavaLangObject, jstring{}, kJavaNioByteBuffer,
+                      jint{}}},
+    },
+};
+// clang-format on
+
+// Size of each result slot written by the executor.
+inline constexpr std::size_t kBatchResultSlotSize = 8;
+
+// Refers to the primitive result of one call recorded in a `Batch`.
+template <typename T>
+struct BatchResult {
+  std::size_t slot_;
+};
+
+// Records a sequence of calls on one object of `class_v_` and then executes
+// them in a single JNI transition through `com.jnibind.BatchExecutor`, which
+// must be on the classpath.
+//
+// Calls are encoded into a buffer that is shared with Java as a direct
+// `ByteBuffer`.  Each call is an opcode (an index into the table of every
+// method overload of `class_v_`, see `OpIndex`) followed by its arguments at
+// their natural width in native byte order.  Primitive results are written
+// back by Java to the same buffer and are readable with `Get` after `Execute`.
+//
+// Only methods taking primitive arguments and returning void, a primitive, or
+// `Self` may be batched.
+//
+//   Batch<kBuilder> batch;
+//   batch.Call<"setOne">(1).Call<"setTwo">(2);
+//   BatchResult<jint> sum = batch.Call<"sum">();
+//   if (batch.Execute(builder)) {
+//     jint val = batch.Get(sum);
+//   }
+template <const auto& class_v_>
+class Batch {
+ public:
+  Batch() = default;
+
+  // Records `method_name` with `args`.  Returns this batch for methods that
+  // return `Self`, a `BatchResult` for methods returning a primitive.
+  template <metaprogramming::StringLiteral method_name, typename... Args>
+  decltype(auto) Call(Args... args) {
+    using OverloadRefT =
+        typename BoundMethod<class_v_, method_name, Args...>::OverloadRefT;
+    using IdT = typename OverloadRefT::IdT;
+    using ReturnIdT = typename OverloadRefT::ReturnIdT;
+    using ReturnT = typename OverloadRefT::ReturnProxied;
+
+    static_assert(!IdT::kIsStatic, "Only instance methods can be batched.");
+    static_assert(IdT::kAncestorIdx == 0,
+                  "Only methods declared on the class can be batched.");
+    static_assert((std::is_arithmetic_v<Args> && ...),
+                  "Only primitive arguments can be batched.");
+    static_assert(ReturnIdT::kIsSelf || std::is_void_v<ReturnT> ||
+                      std::is_arithmetic_v<ReturnT>,
+                  "Only methods returning void, a primitive or Self can be "
+                  "batched.");
+
+    Write(static_cast<std::uint16_t>(
+        OpIndex<IdT::kIdx, IdT::kSecondaryIdx>()));
+    WriteArgs<ReturnIdT>(std::index_sequence_for<Args...>{}, args...);
+
+    if constexpr (ReturnIdT::kIsSelf) {
+      return *this;
+    } else if constexpr (!std::is_void_v<ReturnT>) {
+      return BatchResult<ReturnT>{num_results_++};
+    }
+  }
+
+  // Executes every recorded call on `object`, in order.  A batch may be
+  // executed more than once, and re-executing a batch with no newly recorded
+  // calls creates no new Java objects.
+  //
+  // If a call throws, the calls after it are skipped and the exception is
+  // cleared and returned (see `Checked`).  Every result then reads as zero.
+  CheckedResult<void> Execute(jobject object) {
+    results_offset_ = (ops_size_ + kBatchResultSlotSize - 1) /
+                      kBatchResultSlotSize * kBatchResultSlotSize;
+    buffer_.resize(results_offset_ + num_results_ * kBatchResultSlotSize);
+
+    if (!descriptors_string_) {
+      descriptors_string_.emplace(Descriptors().c_str());
+    }
+
+    // Recording calls may have grown (and so moved) the buffer.
+    if (!byte_buffer_ || byte_buffer_address_ != buffer_.data() ||
+        byte_buffer_capacity_ != buffer_.size()) {
+      byte_buffer_.emplace(
+          PromoteToGlobal{},
+          JniHelper::NewDirectByteBuffer(buffer_.data(),
+                                         static_cast<jlong>(buffer_.size())));
+      byte_buffer_address_ = buffer_.data();
+      byte_buffer_capacity_ = buffer_.size();
+    }
+
+    CheckedResult<void> ret = Checked([&] {
+      StaticRef<kBatchExecutorClass>{}.Call<"execute">(
+          object, *descriptors_string_, *byte_buffer_,
+          static_cast<jint>(ops_size_));
+    });
+
+    if (!ret) {
+      std::memset(buffer_.data() + results_offset_, 0,
+                  buffer_.size() - results_offset_);
+    }
+
+    return ret;
+  }
+
+  CheckedResult<void> Execute(const RefBase<jobject>& object) {
+    return Execute(static_cast<jobject>(object));
+  }
+
+  // Reads a result of the most recent `Execute`.  Results are invalidated by
+  // recording further calls, and are zero if `Execute` failed.
+  template <typename T>
+  T Get(BatchResult<T> result) const {
+    T ret;
+    std::memcpy(&ret,
+                buffer_.data() + results_offset_ +
+                    result.slot_ * kBatchResultSlotSize,
+                sizeof(T));
+
+    return ret;
+  }
+
+  // Discards all recorded calls, retaining allocations for reuse.
+  void Clear() {
+    buffer_.clear();
+    ops_size_ = 0;
+    num_results_ = 0;
+  }
+
+ private:
+  using JniT_ = JniT<jobject, class_v_, kDefaultClassLoader, kDefaultJvm>;
+  using MethodsT = std::decay_t<decltype(JniT_::stripped_class_v.methods_)>;
+
+  template <std::size_t I>
+  static constexpr std::size_t NumOverloads() {
+    return std::tuple_size_v<std::decay_t<
+        decltype(std::get<I>(JniT_::stripped_class_v.methods_).invocations_)>>;
+  }
+
+  template <std::size_t... Is>
+  static constexpr std::size_t NumOverloadsOf(std::index_sequence<Is...>) {
+    return (NumOverloads<Is>() + ... + 0);
+  }
+
+  // Overloads are numbered in declaration order across every method of
+  // `class_v_`, so each has the same index in every batch of the class.
+  template <std::size_t I, std::size_t J>
+  static constexpr std::size_t OpIndex() {
+    constexpr std::size_t kOpIndex =
+        NumOverloadsOf(std::make_index_sequence<I>{}) + J;
+    static_assert(kOpIndex <= 0xFFFF, "Too many methods to batch.");
+
+    return kOpIndex;
+  }
+
+  template <std::size_t I, std::size_t... Js>
+  static void AppendDescriptors(std::string& descriptors,
+                                std::index_sequence<Js...>) {
+    // Descriptors are separated by spaces which are not legal in either
+    // method names or signatures.
+    ((descriptors.append(Id<JniT_, IdType::OVERLOAD, I, Js, kNoIdx, 0>::Name())
+          .append(Signature_v<Id<JniT_, IdType::OVERLOAD, I, Js, kNoIdx, 0>>)
+          .push_back(' ')),
+     ...);
+  }
+
+  template <std::size_t... Is>
+  static std::string BuildDescriptors(std::index_sequence<Is...>) {
+    std::string descriptors;
+    (AppendDescriptors<Is>(descriptors,
+                           std::make_index_sequence<NumOverloads<Is>()>{}),
+     ...);
+
+    return descriptors;
+  }
+
+  // The name and signature of every overload of `class_v_`, by `OpIndex`.
+  static const std::string& Descriptors() {
+    static const std::string* descriptors = new std::string{BuildDescriptors(
+        std::make_index_sequence<std::tuple_size_v<MethodsT>>{})};
+
+    return *descriptors;
+  }
+
+  template <typename T>
+  void Write(T val) {
+    buffer_.resize(ops_size_ + sizeof(T));
+    std::memcpy(buffer_.data() + ops_size_, &val, sizeof(T));
+    ops_size_ += sizeof(T);
+  }
+
+  // Arguments are packed with the width of their declared parameter.
+  template <typename ReturnIdT, std::size_t... Is, typename... Args>
+  void WriteArgs(std::index_sequence<Is...>, Args... args) {
+    (WriteArg<Signature_v<typename ReturnIdT::template ChangeIdx<2, Is>>[0]>(
+         args),
+     ...);
+  }
+
+  template <char kSignatureChar, typename T>
+  void WriteArg(T arg) {
+    const jvalue val = ToJvalue<kSignatureChar>(arg);
+
+    if constexpr (kSignatureChar == 'Z') {
+      Write(val.z);
+    } else if constexpr (kSignatureChar == 'B') {
+      Write(val.b);
+    } else if constexpr (kSignatureChar == 'C') {
+      Write(val.c);
+    } else if constexpr (kSignatureChar == 'S') {
+      Write(val.s);
+    } else if constexpr (kSignatureChar == 'I') {
+      Write(val.i);
+    } else if constexpr (kSignatureChar == 'J') {
+      Write(val.j);
+    } else if constexpr (kSignatureChar == 'F') {
+      Write(val.f);
+    } else {
+      Write(val.d);
+    }
+  }
+
+  // Encoded calls in [0, ops_size_) followed by result slots from
+  // `results_offset_`.
+  std::vector<unsigned char> buffer_;
+  std::size_t ops_size_ = 0;
+  std::size_t results_offset_ = 0;
+  std::size_t num_results_ = 0;
+
+  // Java copies of `Descriptors()` and `buffer_`, reused across executions.
+  std::optional<GlobalString> descriptors_string_;
+  std::optional<GlobalObject<kJavaNioByteBuffer>> byte_buffer_;
+  const unsigned char* byte_buffer_address_ = nullptr;
+  std::size_t byte_buffer_capacity_ = 0;
+};
+#endif  // __cplusplus >= 202002L
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_BATCH_H_
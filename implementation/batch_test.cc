@@ -0,0 +1,192 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Batch;
+using ::jni::BatchResult;
+using ::jni::Class;
+using ::jni::Fake;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Self;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::StrEq;
+
+static constexpr Class kClass{
+    "kClass",
+    Method{"setOne", Return{Self{}}, Params<jint>{}},
+    Method{"setTwo", Return<void>{}, Params<jboolean, jlong>{}},
+    Method{"sum", Return<jint>{}, Params<>{}},
+};
+
+template <typename T>
+T ReadAt(const unsigned char* buffer, std::size_t offset) {
+  T ret;
+  std::memcpy(&ret, buffer + offset, sizeof(T));
+  return ret;
+}
+
+TEST_F(JniTest, Batch_EncodesCallsIntoOneTransition) {
+  unsigned char* address = nullptr;
+  jlong capacity = 0;
+
+  EXPECT_CALL(*env_, GetMethodID).Times(0);
+  EXPECT_CALL(*env_, CallIntMethodV).Times(0);
+  EXPECT_CALL(*env_, CallVoidMethodV).Times(0);
+  EXPECT_CALL(*env_, CallObjectMethodV).Times(0);
+  EXPECT_CALL(*env_,
+              NewStringUTF(StrEq("setOne(I)LkClass; setTwo(ZJ)V sum()I ")));
+  EXPECT_CALL(*env_, NewDirectByteBuffer)
+      .WillOnce([&](void* addr, jlong cap) {
+        address = static_cast<unsigned char*>(addr);
+        capacity = cap;
+        return Fake<jobject>(3);
+      });
+  EXPECT_CALL(*env_,
+              GetStaticMethodID(_, StrEq("execute"),
+                                StrEq("(Ljava/lang/Object;Ljava/lang/String;"
+                                      "Ljava/nio/ByteBuffer;I)V")));
+  EXPECT_CALL(*env_, CallStaticVoidMethodV).Times(1);
+
+  Batch<kClass> batch;
+  batch.Call<"setOne">(1).Call<"setOne">(2);
+  batch.Call<"setTwo">(jboolean{true}, jlong{3});
+  batch.Execute(Fake<jobject>());
+
+  // 3 ops: opcode + jint, opcode + jint, opcode + jboolean + jlong, padded
+  // to a result slot boundary.
+  ASSERT_NE(address, nullptr);
+  EXPECT_EQ(capacity, 24);
+  EXPECT_EQ(ReadAt<std::uint16_t>(address, 0), 0);
+  EXPECT_EQ(ReadAt<jint>(address, 2), 1);
+  EXPECT_EQ(ReadAt<std::uint16_t>(address, 6), 0);
+  EXPECT_EQ(ReadAt<jint>(address, 8), 2);
+  EXPECT_EQ(ReadAt<std::uint16_t>(address, 12), 1);
+  EXPECT_EQ(ReadAt<jboolean>(address, 14), JNI_TRUE);
+  EXPECT_EQ(ReadAt<jlong>(address, 15), 3);
+}
+
+TEST_F(JniTest, Batch_ReadsResultsWrittenByExecutor) {
+  unsigned char* address = nullptr;
+  jlong capacity = 0;
+
+  EXPECT_CALL(*env_, NewDirectByteBuffer)
+      .WillOnce([&](void* addr, jlong cap) {
+        address = static_cast<unsigned char*>(addr);
+        capacity = cap;
+        return Fake<jobject>(3);
+      });
+  // Results follow the 10 bytes of ops in 8 byte aligned slots.
+  EXPECT_CALL(*env_, CallStaticVoidMethodV).WillOnce([&](jclass, jmethodID,
+                                                         va_list) {
+    ASSERT_EQ(capacity, 16 + 8 + 8);
+    const jint first = 10;
+    const jint second = 20;
+    std::memcpy(address + 16, &first, sizeof(jint));
+    std::memcpy(address + 24, &second, sizeof(jint));
+  });
+
+  Batch<kClass> batch;
+  BatchResult<jint> first = batch.Call<"sum">();
+  batch.Call<"setOne">(5);
+  BatchResult<jint> second = batch.Call<"sum">();
+  batch.Execute(LocalObject<kClass>{Fake<jobject>()});
+
+  EXPECT_EQ(batch.Get(first), 10);
+  EXPECT_EQ(batch.Get(second), 20);
+}
+
+TEST_F(JniTest, Batch_OpcodesIndexTheClassDefinition) {
+  std::vector<unsigned char*> addresses;
+
+  // The table lists every overload of the class whatever was recorded, and
+  // outlives `Clear`.
+  EXPECT_CALL(*env_,
+              NewStringUTF(StrEq("setOne(I)LkClass; setTwo(ZJ)V sum()I ")))
+      .Times(1);
+  EXPECT_CALL(*env_, NewDirectByteBuffer)
+      .WillRepeatedly([&](void* addr, jlong) {
+        addresses.push_back(static_cast<unsigned char*>(addr));
+        return Fake<jobject>(3);
+      });
+
+  Batch<kClass> batch;
+  batch.Call<"sum">();
+  batch.Execute(Fake<jobject>());
+  ASSERT_FALSE(addresses.empty());
+  EXPECT_EQ(ReadAt<std::uint16_t>(addresses.back(), 0), 2);
+
+  batch.Clear();
+  batch.Call<"setTwo">(jboolean{false}, jlong{1});
+  batch.Execute(Fake<jobject>());
+  EXPECT_EQ(ReadAt<std::uint16_t>(addresses.back(), 0), 1);
+}
+
+TEST_F(JniTest, Batch_ReexecutionReusesDescriptorsAndBuffer) {
+  EXPECT_CALL(*env_, NewStringUTF).Times(1);
+  EXPECT_CALL(*env_, NewDirectByteBuffer).Times(1);
+  EXPECT_CALL(*env_, CallStaticVoidMethodV).Times(3);
+
+  Batch<kClass> batch;
+  batch.Call<"sum">();
+  EXPECT_TRUE(batch.Execute(Fake<jobject>()));
+  EXPECT_TRUE(batch.Execute(Fake<jobject>()));
+  EXPECT_TRUE(batch.Execute(Fake<jobject>()));
+}
+
+TEST_F(JniTest, Batch_ReturnsAndClearsExceptionsAndZeroesResults) {
+  unsigned char* address = nullptr;
+
+  EXPECT_CALL(*env_, NewDirectByteBuffer).WillOnce([&](void* addr, jlong) {
+    address = static_cast<unsigned char*>(addr);
+    return Fake<jobject>(3);
+  });
+  // The first call completes before the second throws.
+  EXPECT_CALL(*env_, CallStaticVoidMethodV)
+      .WillOnce([&](jclass, jmethodID, va_list) {
+        const jint first = 10;
+        std::memcpy(address + 8, &first, sizeof(jint));
+      });
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_TRUE));
+  EXPECT_CALL(*env_, ExceptionOccurred)
+      .WillOnce(testing::Return(static_cast<jthrowable>(Fake<jobject>(4))));
+  EXPECT_CALL(*env_, ExceptionClear);
+
+  Batch<kClass> batch;
+  BatchResult<jint> first = batch.Call<"sum">();
+  BatchResult<jint> second = batch.Call<"sum">();
+
+  EXPECT_FALSE(batch.Execute(Fake<jobject>()));
+  EXPECT_EQ(batch.Get(first), 0);
+  EXPECT_EQ(batch.Get(second), 0);
+}
+
+}  // namespace
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_IMPLEMENTATION_BOUND_FIELD_H_
+#define JNI_BIND_IMPLEMENTATION_BOUND_FIELD_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <cassert>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/class_ref.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/field_ref.h"
+#include "implementation/id_type.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_type.h"
+#include "implementation/jvm.h"
+#include "implementation/ref_base.h"
+#include "implementation/signature.h"
+#include "jni_dep.h"
+#include "metaprogramming/modified_max.h"
+#include "metaprogramming/string_literal.h"
+
+namespace jni {
+
+#if __cplusplus >= 202002L
+// A field of `class_v_` whose `jclass` and `jfieldID` are resolved once on
+// construction.  See `BoundMethod`.
+//
+//   BoundField<kClass, "intField"> int_field;
+//   for (auto& obj : objs) { int_field.Set(obj, int_field.Get(obj) + 1); }
+template <const auto& class_v_, metaprogramming::StringLiteral field_name>
+class BoundField {
+ public:
+  using JniT_ = JniT<jobject, class_v_, kDefaultClassLoader, kDefaultJvm>;
+
+  using FieldsT = std::decay_t<decltype(JniT_::stripped_class_v.fields_)>;
+
+  template <std::size_t... Is>
+  static constexpr std::size_t SelectCandidate(std::index_sequence<Is...>) {
+    constexpr std::string_view kName{field_name.value};
+
+    return metaprogramming::ModifiedMax(
+        {((std::get<Is>(JniT_::stripped_class_v.fields_).name_ == kName)
+              ? std::size_t{Is}
+              : metaprogramming::kNegativeOne)...,
+         metaprogramming::kNegativeOne});
+  }
+
+  static constexpr std::size_t kIdx =
+      SelectCandidate(std::make_index_sequence<std::tuple_size_v<FieldsT>>());
+  static_assert(kIdx != metaprogramming::kNegativeOne,
+                "JNI Error: No field with this name.");
+
+  using FieldRefT = FieldRef<JniT_, IdType::FIELD, kIdx>;
+
+  BoundField()
+      : field_id_(FieldRefT::GetFieldID(
+            ClassRef_t<JniT_>::GetAndMaybeLoadClassRef(nullptr))) {
+    assert(field_id_ != nullptr);
+  }
+
+  // `clazz` must outlive this object (e.g. a global reference). It may come
+  // from any loader, so its ID is resolved directly rather than through the
+  // default loader's cache.
+  explicit BoundField(jclass clazz)
+      : field_id_(JniHelper::GetFieldID(
+            clazz, FieldRefT::IdT::Name(),
+            Signature_v<typename FieldRefT::IdT>.data())) {
+    assert(field_id_ != nullptr);
+  }
+
+  auto Get(jobject object) const {
+    return FieldRefT::GetWithFieldID(object, field_id_);
+  }
+
+  auto Get(const RefBase<jobject>& object) const {
+    return Get(static_cast<jobject>(object));
+  }
+
+  template <typename T>
+  void Set(jobject object, T&& value) const {
+    FieldRefT::SetWithFieldID(object, field_id_, std::forward<T>(value));
+  }
+
+  template <typename T>
+  void Set(const RefBase<jobject>& object, T&& value) const {
+    Set(static_cast<jobject>(object), std::forward<T>(value));
+  }
+
+  jfieldID GetFieldID() const { return field_id_; }
+
+ private:
+  jfieldID field_id_;
+};
+#endif  // __cplusplus >= 202002L
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_BOUND_FIELD_H_
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <type_traits>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::BoundField;
+using ::jni::Class;
+using ::jni::Fake;
+using ::jni::Field;
+using ::jni::LocalObject;
+using ::jni::test::AsGlobal;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::Return;
+using ::testing::StrEq;
+
+static constexpr Class kClass2{"kClass2"};
+
+static constexpr Class kClass{
+    "kClass",
+    Field{"intField", jint{}},
+    Field{"objectField", kClass2},
+};
+
+static_assert(std::is_trivially_copyable_v<BoundField<kClass, "intField">>);
+
+TEST_F(JniTest, BoundField_ResolvesIdOnceOnConstruction) {
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("intField"), StrEq("I")))
+      .WillOnce(Return(Fake<jfieldID>()));
+  EXPECT_CALL(*env_, GetIntField(Fake<jobject>(1), Fake<jfieldID>()))
+      .WillOnce(Return(5));
+  EXPECT_CALL(*env_, GetIntField(Fake<jobject>(2), Fake<jfieldID>()))
+      .WillOnce(Return(6));
+  EXPECT_CALL(*env_, SetIntField(Fake<jobject>(1), Fake<jfieldID>(), 7));
+
+  BoundField<kClass, "intField"> int_field;
+  EXPECT_EQ(int_field.GetFieldID(), Fake<jfieldID>());
+  EXPECT_EQ(int_field.Get(Fake<jobject>(1)), 5);
+  EXPECT_EQ(int_field.Get(Fake<jobject>(2)), 6);
+  int_field.Set(Fake<jobject>(1), 7);
+}
+
+TEST_F(JniTest, BoundField_SupportsObjects) {
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("objectField"), StrEq("LkClass2;")))
+      .WillOnce(Return(Fake<jfieldID>()));
+  EXPECT_CALL(*env_, GetObjectField(_, Fake<jfieldID>()))
+      .WillOnce(Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, SetObjectField(_, Fake<jfieldID>(), Fake<jobject>(3)));
+
+  LocalObject<kClass> obj{Fake<jobject>(1)};
+  BoundField<kClass, "objectField"> object_field;
+
+  LocalObject<kClass2> val{object_field.Get(obj)};
+  EXPECT_EQ(static_cast<jobject>(val), Fake<jobject>(2));
+  object_field.Set(obj, Fake<jobject>(3));
+}
+
+TEST_F(JniTest, BoundField_ProvidedClassBypassesTheDefaultLoaderCache) {
+  EXPECT_CALL(*env_, GetFieldID(Fake<jclass>(2), StrEq("intField"), _))
+      .WillOnce(Return(Fake<jfieldID>(2)));
+  EXPECT_CALL(*env_, GetFieldID(AsGlobal(Fake<jclass>()), StrEq("intField"), _))
+      .WillOnce(Return(Fake<jfieldID>(1)));
+
+  BoundField<kClass, "intField"> foreign_field{Fake<jclass>(2)};
+  BoundField<kClass, "intField"> field;
+
+  EXPECT_EQ(foreign_field.GetFieldID(), Fake<jfieldID>(2));
+  EXPECT_EQ(field.GetFieldID(), Fake<jfieldID>(1));
+}
+
+}  // namespace
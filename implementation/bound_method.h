@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_IMPLEMENTATION_BOUND_METHOD_H_
+#define JNI_BIND_IMPLEMENTATION_BOUND_METHOD_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/class_ref.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/id_type.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_type.h"
+#include "implementation/jvm.h"
+#include "implementation/method_ancestry.h"
+#include "implementation/method_selection.h"
+#include "implementation/ref_base.h"
+#include "implementation/signature.h"
+#include "jni_dep.h"
+#include "metaprogramming/invocable_map_20.h"
+#include "metaprogramming/string_literal.h"
+
+namespace jni {
+
+#if __cplusplus >= 202002L
+// A method of `class_v_` whose `jclass` and `jmethodID` are resolved once on
+// construction.  Invocations then skip the cached ID loads that `Call` makes,
+// which makes this suitable for inner loops.
+//
+// `Args` selects the overload exactly as arguments to `Call` would.  This
+// type is trivially copyable and may be stored in hot structs, however, it is
+// only valid for the lifetime of the JVM it was bound in.  Debug builds assert
+// on construction that the ID resolved.
+//
+//   BoundMethod<kClass, "foo", jint> foo;
+//   for (auto& obj : objs) { foo(obj, 123); }
+template <const auto& class_v_, metaprogramming::StringLiteral method_name,
+          typename... Args>
+class BoundMethod {
+ public:
+  using JniT_ = JniT<jobject, class_v_, kDefaultClassLoader, kDefaultJvm>;
+
+  using MethodsT = std::decay_t<decltype(JniT_::stripped_class_v.methods_)>;
+  using InvocableMap20T = metaprogramming::InvocableMap20<
+      BoundMethod, JniT_::stripped_class_v, BoundMethod,
+      decltype(&JniT_::ClassT::methods_), &JniT_::ClassT::methods_>;
+
+  static constexpr std::size_t kIdx = InvocableMap20T::SelectCandidate(
+      method_name, std::make_index_sequence<std::tuple_size_v<MethodsT>>());
+
+  // Methods not declared on `class_v_` are found on its `Extends` ancestors.
+  using IdT = MethodOverloadSetId_t<JniT_, kIdx, method_name>;
+  using MethodSelectionForArgs =
+      OverloadSelector<IdT, IdType::OVERLOAD, IdType::OVERLOAD_PARAM, Args...>;
+  static_assert(MethodSelectionForArgs::kIsValidArgSet,
+                "JNI Error: Invalid argument set.");
+
+  using OverloadRefT = typename MethodSelectionForArgs::_OverloadRef;
+
+  BoundMethod()
+      : clazz_(ClassRef_t<JniT_>::GetAndMaybeLoadClassRef(nullptr)),
+        method_id_(OverloadRefT::GetMethodID(clazz_)) {
+    assert(method_id_ != nullptr);
+  }
+
+  // `clazz` must outlive this object (e.g. a global reference). It may come
+  // from any loader, so its ID is resolved directly rather than through the
+  // default loader's cache.
+  explicit BoundMethod(jclass clazz)
+      : clazz_(clazz),
+        method_id_(JniHelper::GetMethodID(
+            clazz, OverloadRefT::IdT::Name(),
+            Signature_v<typename OverloadRefT::IdT>.data())) {
+    assert(method_id_ != nullptr);
+  }
+
+  // Arguments are forwarded exactly as they are by `Call`.
+  template <typename... Ts>
+  auto operator()(jobject object, Ts&&... ts) const {
+    return OverloadRefT::InvokeWithMethodID(clazz_, method_id_, object,
+                                            std::forward<Ts>(ts)...);
+  }
+
+  template <typename... Ts>
+  auto operator()(const RefBase<jobject>& object, Ts&&... ts) const {
+    return (*this)(static_cast<jobject>(object), std::forward<Ts>(ts)...);
+  }
+
+  jclass GetJClass() const { return clazz_; }
+  jmethodID GetMethodID() const { return method_id_; }
+
+ private:
+  jclass clazz_;
+  jmethodID method_id_;
+};
+#endif  // __cplusplus >= 202002L
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_BOUND_METHOD_H_
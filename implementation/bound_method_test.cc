@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <type_traits>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::BoundMethod;
+using ::jni::Class;
+using ::jni::Fake;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Overload;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::test::AsGlobal;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::StrEq;
+
+static constexpr Class kClass2{"kClass2"};
+
+// clang-format off
+static constexpr Class kClass{
+    "kClass",
+    Method{"Foo", Return<jint>{}, Params<jint, jfloat>{}},
+    Method{"Bar",
+        Overload{Return<void>{}},
+        Overload{Return<void>{}, Params<jlong>{}},
+    },
+    Method{"Baz", Return{kClass2}},
+    Method{"Qux", Return<void>{}, Params{jstring{}, kClass2}},
+};
+// clang-format on
+
+static_assert(std::is_trivially_copyable_v<BoundMethod<kClass, "Foo", jint,
+                                                       jfloat>>);
+
+TEST_F(JniTest, BoundMethod_ResolvesIdsOnceOnConstruction) {
+  EXPECT_CALL(*env_, FindClass(StrEq("kClass"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("(IF)I")))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+  EXPECT_CALL(*env_, CallIntMethodV(Fake<jobject>(1), Fake<jmethodID>(1), _))
+      .WillOnce(testing::Return(1));
+  EXPECT_CALL(*env_, CallIntMethodV(Fake<jobject>(2), Fake<jmethodID>(1), _))
+      .WillOnce(testing::Return(2));
+
+  BoundMethod<kClass, "Foo", jint, jfloat> foo;
+  EXPECT_EQ(foo.GetJClass(), AsGlobal(Fake<jclass>()));
+  EXPECT_EQ(foo.GetMethodID(), Fake<jmethodID>(1));
+
+  auto foo_copy = foo;
+  EXPECT_EQ(foo(Fake<jobject>(1), 1, 2.f), 1);
+  EXPECT_EQ(foo_copy(Fake<jobject>(2), 1, 2.f), 2);
+}
+
+TEST_F(JniTest, BoundMethod_SelectsOverloadFromArgs) {
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Bar"), StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Bar"), StrEq("(J)V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+  EXPECT_CALL(*env_, CallVoidMethodV(_, Fake<jmethodID>(1), _));
+  EXPECT_CALL(*env_, CallVoidMethodV(_, Fake<jmethodID>(2), _));
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  BoundMethod<kClass, "Bar">{}(obj);
+  BoundMethod<kClass, "Bar", jlong>{}(obj, jlong{1});
+}
+
+TEST_F(JniTest, BoundMethod_ReturnsObjects) {
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(1), _, _))
+      .WillOnce(testing::Return(Fake<jobject>(2)));
+
+  BoundMethod<kClass, "Baz"> baz;
+  LocalObject<kClass2> ret{baz(Fake<jobject>(1))};
+  EXPECT_EQ(static_cast<jobject>(ret), Fake<jobject>(2));
+}
+
+TEST_F(JniTest, BoundMethod_BindsToProvidedClass) {
+  EXPECT_CALL(*env_, FindClass(StrEq("kClass"))).Times(0);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), _))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+
+  BoundMethod<kClass, "Foo", jint, jfloat> foo{Fake<jclass>(2)};
+  EXPECT_EQ(foo.GetJClass(), Fake<jclass>(2));
+}
+
+TEST_F(JniTest, BoundMethod_ProvidedClassBypassesTheDefaultLoaderCache) {
+  EXPECT_CALL(*env_, GetMethodID(Fake<jclass>(2), StrEq("Foo"), _))
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>()), StrEq("Foo"), _))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+
+  BoundMethod<kClass, "Foo", jint, jfloat> foreign_foo{Fake<jclass>(2)};
+  BoundMethod<kClass, "Foo", jint, jfloat> foo;
+
+  EXPECT_EQ(foreign_foo.GetMethodID(), Fake<jmethodID>(2));
+  EXPECT_EQ(foo.GetMethodID(), Fake<jmethodID>(1));
+}
+
+TEST_F(JniTest, BoundMethod_ForwardsStringAndObjectArguments) {
+  EXPECT_CALL(*env_, NewStringUTF(StrEq("hello")))
+      .WillOnce(testing::Return(Fake<jstring>()));
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(1), _, _));
+
+  LocalObject<kClass2> arg{Fake<jobject>(2)};
+  BoundMethod<kClass, "Qux", const char*, LocalObject<kClass2>&> qux;
+  qux(Fake<jobject>(1), "hello", arg);
+
+  EXPECT_EQ(static_cast<jobject>(arg), Fake<jobject>(2));
+}
+
+}  // namespace
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_IMPLEMENTATION_CALL_CHECKED_H_
+#define JNI_BIND_IMPLEMENTATION_CALL_CHECKED_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <type_traits>
+#include <utility>
+
+#include "implementation/expected.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/local_exception.h"
+#include "implementation/promotion_mechanics_tags.h"
+#include "jni_dep.h"
+#include "metaprogramming/string_literal.h"
+
+namespace jni {
+
+// The exception caught by `Checked` and `CallChecked`.
+using CheckedException = LocalException<>;
+
+template <typename T>
+using CheckedResult = Expected<T, CheckedException>;
+
+// Invokes `func` and then checks for a pending Java exception.
+//
+// On success, the result of `func` is returned and the only additional cost is
+// one `ExceptionCheck` (which, unlike `ExceptionOccurred`, creates no local).
+// On failure the exception is cleared and returned as a `LocalException`,
+// leaving the thread safe to make further JNI calls.
+//
+//   auto ret = jni::Checked([&] { return obj.Call<"foo">(1); });
+//   if (!ret) { LOG(ERROR) << ...; }
+template <typename Func>
+auto Checked(Func&& func) -> CheckedResult<decltype(func())> {
+  using ReturnT = decltype(func());
+
+  if constexpr (std::is_void_v<ReturnT>) {
+    func();
+
+    if (!JniHelper::ExceptionCheck()) {
+      return {};
+    }
+  } else {
+    ReturnT ret = func();
+
+    if (!JniHelper::ExceptionCheck()) {
+      return ret;
+    }
+  }
+
+  jthrowable exception = JniHelper::ExceptionOccurred();
+  JniHelper::ExceptionClear();
+
+  return Unexpected<CheckedException>{
+      CheckedException{AdoptLocal{}, static_cast<jobject>(exception)}};
+}
+
+#if __cplusplus >= 202002L
+// Calls `method_name` on `ref` (e.g. a `LocalObject` or `StaticRef`) with
+// `args`, as in `ref.Call<method_name>(args...)`, see `Checked`.
+//
+//   jni::CheckedResult<jint> ret = jni::CallChecked<"foo">(obj, 1);
+template <metaprogramming::StringLiteral method_name, typename RefT,
+          typename... Args>
+auto CallChecked(RefT&& ref, Args&&... args) {
+  return Checked([&]() {
+    return ref.template Call<method_name>(std::forward<Args>(args)...);
+  });
+}
+#endif  // __cplusplus >= 202002L
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_CALL_CHECKED_H_
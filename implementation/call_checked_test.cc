@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::CallChecked;
+using ::jni::Checked;
+using ::jni::CheckedResult;
+using ::jni::Class;
+using ::jni::Fake;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::StaticRef;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::InSequence;
+
+static constexpr Class kClass{
+    "kClass",
+    Static{
+        Method{"StaticFoo", Return<void>{}, Params<>{}},
+    },
+    Method{"Foo", Return<jint>{}, Params<jint>{}},
+    Method{"Bar", Return{Class{"kClass2"}}, Params<>{}},
+};
+
+jthrowable FakeThrowable() {
+  return static_cast<jthrowable>(Fake<jobject>(3));
+}
+
+TEST_F(JniTest, CallChecked_ReturnsValueWithoutMaterializingException) {
+  EXPECT_CALL(*env_, CallIntMethodV).WillOnce(testing::Return(5));
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_FALSE));
+  EXPECT_CALL(*env_, ExceptionOccurred).Times(0);
+  EXPECT_CALL(*env_, ExceptionClear).Times(0);
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  CheckedResult<jint> ret = CallChecked<"Foo">(obj, 1);
+
+  ASSERT_TRUE(ret.has_value());
+  EXPECT_EQ(*ret, 5);
+}
+
+TEST_F(JniTest, CallChecked_ReturnsAndClearsPendingException) {
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(FakeThrowable())).Times(1);
+  {
+    InSequence seq;
+    EXPECT_CALL(*env_, CallIntMethodV);
+    EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_TRUE));
+    EXPECT_CALL(*env_, ExceptionOccurred)
+        .WillOnce(testing::Return(FakeThrowable()));
+    EXPECT_CALL(*env_, ExceptionClear);
+  }
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  CheckedResult<jint> ret = CallChecked<"Foo">(obj, 1);
+
+  ASSERT_FALSE(ret);
+  EXPECT_EQ(static_cast<jobject>(ret.error()), FakeThrowable());
+}
+
+TEST_F(JniTest, CallChecked_SupportsObjectReturns) {
+  EXPECT_CALL(*env_, CallObjectMethodV)
+      .WillOnce(testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_FALSE));
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  auto ret = CallChecked<"Bar">(obj);
+
+  ASSERT_TRUE(ret);
+  EXPECT_EQ(static_cast<jobject>(*ret), Fake<jobject>(2));
+}
+
+TEST_F(JniTest, CallChecked_SupportsStaticVoidMethods) {
+  EXPECT_CALL(*env_, CallStaticVoidMethodV);
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_TRUE));
+  EXPECT_CALL(*env_, ExceptionOccurred)
+      .WillOnce(testing::Return(FakeThrowable()));
+  EXPECT_CALL(*env_, ExceptionClear);
+
+  CheckedResult<void> ret = CallChecked<"StaticFoo">(StaticRef<kClass>{});
+
+  EXPECT_FALSE(ret.has_value());
+}
+
+TEST_F(JniTest, Checked_WrapsArbitraryCalls) {
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_FALSE));
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  CheckedResult<void> ret = Checked([&] { obj.Call<"Foo">(1); });
+
+  EXPECT_TRUE(ret);
+}
+
+}  // namespace
@@ -0,0 +1,170 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_CLASS_KEYED_MAP_H_
+#define JNI_BIND_IMPLEMENTATION_CLASS_KEYED_MAP_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+#include "jni_dep.h"
+
+namespace jni {
+
+// The number of live runtime instances of a non-default class loader that each
+// get their own `jclass` (and IDs) for a class, see `ClassRef`. Further
+// instances share a single `jclass`, as all instances did previously, which
+// resolves IDs against whichever instance loaded it first.
+static constexpr std::size_t kMaxLoaderInstances = 8;
+
+// Counts lookups from loader instances beyond `kMaxLoaderInstances`. Only the
+// first is reported.
+inline std::atomic<std::size_t>& LoaderInstanceOverflows() {
+  static std::atomic<std::size_t> ret_val{0};
+  return ret_val;
+}
+
+inline void FlagLoaderInstanceOverflow() {
+  if (LoaderInstanceOverflows().fetch_add(1, std::memory_order_relaxed) == 0) {
+    fprintf(stderr,
+            "JNI Bind: more than %zu live instances of a class loader, further "
+            "instances share one class (see LoaderInstanceOverflows).\n",
+            kMaxLoaderInstances);
+  }
+}
+
+// Type erased handle so every `ClassKeyedMap` can be cleared on teardown.
+class ClassKeyedMapBase {
+ public:
+  virtual void Erase(jclass clazz) = 0;
+  virtual void Clear() = 0;
+
+ protected:
+  ~ClassKeyedMapBase() = default;
+};
+
+// Maps that hold at least one entry. Appends and teardown are guarded by
+// `ClassKeyedMapsLock`. See JvmRef::~JvmRef.
+inline std::vector<ClassKeyedMapBase*>& ClassKeyedMaps() {
+  static auto* ret_val = new std::vector<ClassKeyedMapBase*>{};
+  return *ret_val;
+}
+
+inline std::mutex& ClassKeyedMapsLock() {
+  static auto* ret_val = new std::mutex{};
+  return *ret_val;
+}
+
+// Erases `clazz` from every map. This must be called before a keyed `jclass`
+// is deleted, as its handle value may later be reused by another class.
+inline void EraseFromClassKeyedMaps(jclass clazz) {
+  std::lock_guard<std::mutex> lock_guard{ClassKeyedMapsLock()};
+  for (ClassKeyedMapBase* class_keyed_map : ClassKeyedMaps()) {
+    class_keyed_map->Erase(clazz);
+  }
+}
+
+// A small, fixed capacity, lock-free map from a global `jclass` to a `ValueT`.
+//
+// This is used for IDs of classes from non-default loaders, where one class
+// definition may be loaded by several loader instances, each giving a distinct
+// `jclass`. Keys are compared by value, so they must be the stable globals
+// held by `ClassRef`, never locals.
+//
+// Entries are released when their `jclass` is deleted (see
+// `EraseFromClassKeyedMaps`) and when the map is cleared on teardown.
+// `ValueT` must be default constructible and provide `Reset()`.
+template <typename ValueT,
+          std::size_t kCapacity = kMaxLoaderInstances + std::size_t{1}>
+class ClassKeyedMap : public ClassKeyedMapBase {
+ public:
+  // Returns the value for `clazz`, claiming an entry for it if it has none, or
+  // null if every entry is taken by another `jclass`.
+  ValueT* FindOrInsert(jclass clazz) {
+    // Erased entries leave gaps, so `clazz` may follow a free entry.
+    for (Entry& entry : entries_) {
+      if (entry.key.load(std::memory_order_acquire) == clazz) {
+        return &entry.value;
+      }
+    }
+
+    for (Entry& entry : entries_) {
+      jclass key = entry.key.load(std::memory_order_acquire);
+
+      if (key == nullptr) {
+        if (entry.key.compare_exchange_strong(key, clazz,
+                                              std::memory_order_acq_rel)) {
+          MaybeRegister();
+          return &entry.value;
+        }
+        // Another thread claimed this entry first, possibly for `clazz`.
+      }
+
+      if (key == clazz) {
+        return &entry.value;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // Resets the value of `clazz` and releases its entry. Not safe to call
+  // concurrently with `FindOrInsert` for the same `clazz`.
+  void Erase(jclass clazz) override {
+    for (Entry& entry : entries_) {
+      if (entry.key.load(std::memory_order_acquire) == clazz) {
+        entry.value.Reset();
+        entry.key.store(nullptr, std::memory_order_release);
+      }
+    }
+  }
+
+  // Resets every value and releases every entry. Not safe to call
+  // concurrently with `FindOrInsert`.
+  void Clear() override {
+    for (Entry& entry : entries_) {
+      entry.value.Reset();
+      entry.key.store(nullptr, std::memory_order_release);
+    }
+    registered_.store(false, std::memory_order_relaxed);
+  }
+
+ private:
+  struct Entry {
+    std::atomic<jclass> key{nullptr};
+    ValueT value;
+  };
+
+  void MaybeRegister() {
+    if (!registered_.exchange(true, std::memory_order_relaxed)) {
+      std::lock_guard<std::mutex> lock_guard{ClassKeyedMapsLock()};
+      ClassKeyedMaps().push_back(this);
+    }
+  }
+
+  std::array<Entry, kCapacity> entries_;
+  std::atomic<bool> registered_{false};
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_CLASS_KEYED_MAP_H_
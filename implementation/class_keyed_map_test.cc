@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::ClassKeyedMap;
+using ::jni::EraseFromClassKeyedMaps;
+using ::jni::Fake;
+using ::jni::metaprogramming::DoubleLockedValue;
+using ::jni::test::JniTest;
+
+// Maps are static as they are registered for teardown by `JvmRef`.
+
+TEST_F(JniTest, ClassKeyedMap_ReturnsTheSameValueForTheSameClass) {
+  static ClassKeyedMap<DoubleLockedValue<jmethodID>, 2> map;
+
+  DoubleLockedValue<jmethodID>* value_1 = map.FindOrInsert(Fake<jclass>(1));
+  DoubleLockedValue<jmethodID>* value_2 = map.FindOrInsert(Fake<jclass>(2));
+
+  ASSERT_NE(value_1, nullptr);
+  ASSERT_NE(value_2, nullptr);
+  EXPECT_NE(value_1, value_2);
+  EXPECT_EQ(map.FindOrInsert(Fake<jclass>(1)), value_1);
+  EXPECT_EQ(map.FindOrInsert(Fake<jclass>(2)), value_2);
+}
+
+TEST_F(JniTest, ClassKeyedMap_ReturnsNullWhenFull) {
+  static ClassKeyedMap<DoubleLockedValue<jmethodID>, 1> map;
+
+  EXPECT_NE(map.FindOrInsert(Fake<jclass>(1)), nullptr);
+  EXPECT_EQ(map.FindOrInsert(Fake<jclass>(2)), nullptr);
+}
+
+TEST_F(JniTest, ClassKeyedMap_ClearReleasesEntriesAndValues) {
+  static ClassKeyedMap<DoubleLockedValue<jmethodID>, 1> map;
+
+  map.FindOrInsert(Fake<jclass>(1))->LoadAndMaybeInit(
+      []() { return Fake<jmethodID>(1); });
+  map.Clear();
+
+  DoubleLockedValue<jmethodID>* value = map.FindOrInsert(Fake<jclass>(2));
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(value->LoadAndMaybeInit([]() { return Fake<jmethodID>(2); }),
+            Fake<jmethodID>(2));
+}
+
+TEST_F(JniTest, ClassKeyedMap_ErasedClassesReresolveTheirValues) {
+  static ClassKeyedMap<DoubleLockedValue<jmethodID>, 2> map;
+
+  map.FindOrInsert(Fake<jclass>(1))->LoadAndMaybeInit(
+      []() { return Fake<jmethodID>(1); });
+  DoubleLockedValue<jmethodID>* value_2 = map.FindOrInsert(Fake<jclass>(2));
+
+  // The handle of a deleted class may be reused by a new one.
+  EraseFromClassKeyedMaps(Fake<jclass>(1));
+  EXPECT_EQ(map.FindOrInsert(Fake<jclass>(1))->LoadAndMaybeInit(
+                []() { return Fake<jmethodID>(3); }),
+            Fake<jmethodID>(3));
+
+  // Other classes keep their entries, even behind a released one.
+  EraseFromClassKeyedMaps(Fake<jclass>(1));
+  EXPECT_EQ(map.FindOrInsert(Fake<jclass>(2)), value_2);
+}
+
+}  // namespace
@@ -60,59 +60,94 @@ class ClassLoaderRef : public ClassLoaderImpl<lifecycleType> {
     }
   }
 
+  // Returns the `jclass` of `class_v` as loaded by this loader instance, see
+  // `ClassRef::GetAndMaybeLoadClassRefForLoader`.
+  template <const auto& class_v>
+  jclass LoadedClassRef() {
+    using JniClassT = JniT<jobject, class_v>;
+    using IdClassT = Id<JniClassT, IdType::CLASS, kNoIdx, kNoIdx, kNoIdx, 0>;
+    using ClassRefT =
+        ClassRef_t<JniT<jobject, class_v, class_loader_v_, jvm_v_, 0>>;
+
+    auto load_lambda = [&]() {
+      // Prevent the object (which is a runtime instance of a class) from
+      // falling out of scope so it is not released.
+
+#if __cplusplus >= 202002L
+      LocalObject loaded_class =
+          (*this).template Call<"loadClass">(IdClassT::kNameUsingDots);
+#elif __clang__
+      LocalObject loaded_class = (*this)("loadClass", IdClassT::kNameUsingDots);
+#else
+      static_assert(false,
+                    "JNI Bind requires C++20 (or later) or C++17 with clang.");
+#endif
+
+      // We only want to create global references if we are actually going
+      // to use them so that they do not leak.
+      jclass test_class{static_cast<jclass>(static_cast<jobject>(loaded_class))};
+      return static_cast<jclass>(JniEnv::GetEnv()->NewGlobalRef(test_class));
+    };
+
+    return ClassRefT::GetAndMaybeLoadClassRefForLoader(
+        static_cast<jobject>(*this), load_lambda);
+  }
+
  public:
   using Base = ClassLoaderImpl<lifecycleType>;
   using Base::Base;
 
   template <const auto& class_v, typename... Params>
   [[nodiscard]] auto BuildLocalObject(Params&&... params) {
-    using JniClassT = JniT<jobject, class_v>;
-    using IdClassT = Id<JniClassT, IdType::CLASS, kNoIdx, kNoIdx, kNoIdx, 0>;
     static_assert(
         !(ParentLoaderForClass<class_loader_v_, class_v>() == kNullClassLoader),
         "Cannot build this class with this loader.");
 
+    using LocalObjectT =
+        LocalObject<class_v, ParentLoaderForClass<class_loader_v_, class_v>(),
+                    JvmForLoader<class_v>()>;
+
     if constexpr (ParentLoaderForClass<class_loader_v_, class_v>() !=
                   kDefaultClassLoader) {
-      ClassRef_t<JniT<jobject, class_v, class_loader_v_, jvm_v_,
-                      0>>::PrimeJClassFromClassLoader([&]() {
-      // Prevent the object (which is a runtime instance of a class) from
-      // falling out of scope so it is not released.
+      // The object is constructed with (and remembers) this instance's class.
+      typename ClassRef_t<JniT<jobject, class_v, class_loader_v_, jvm_v_,
+                               0>>::BuildScope build_scope{
+          LoadedClassRef<class_v>()};
 
-#if __cplusplus >= 202002L
-        LocalObject loaded_class =
-            (*this).template Call<"loadClass">(IdClassT::kNameUsingDots);
-#elif __clang__
-        LocalObject loaded_class =
-            (*this)("loadClass", IdClassT::kNameUsingDots);
-#else
-        static_assert(
-            false, "JNI Bind requires C++20 (or later) or C++17 with clang.");
-#endif
-
-        // We only want to create global references if we are actually going
-        // to use them so that they do not leak.
-        jclass test_class{
-            static_cast<jclass>(static_cast<jobject>(loaded_class))};
-        return static_cast<jclass>(JniEnv::GetEnv()->NewGlobalRef(test_class));
-      });
+      return LocalObjectT{std::forward<Params>(params)...};
+    } else {
+      return LocalObjectT{std::forward<Params>(params)...};
     }
-    return LocalObject<class_v,
-                       ParentLoaderForClass<class_loader_v_, class_v>(),
-                       JvmForLoader<class_v>()>{
-        std::forward<Params>(params)...};
   }
 
   template <const auto& class_v, typename... Params>
   [[nodiscard]] auto BuildGlobalObject(Params&&... params) {
+    using GlobalObjectT =
+        GlobalObject<class_v, ParentLoaderForClass<class_loader_v_, class_v>(),
+                     JvmForLoader<class_v>()>;
+
+    if constexpr (ParentLoaderForClass<class_loader_v_, class_v>() !=
+                  kDefaultClassLoader) {
+      typename ClassRef_t<JniT<jobject, class_v, class_loader_v_, jvm_v_,
+                               0>>::BuildScope build_scope{
+          LoadedClassRef<class_v>()};
+
+      return GlobalObjectT{AdoptGlobal{}, PromotedLocalObject<class_v>(
+                                              std::forward<Params>(params)...)};
+    } else {
+      return GlobalObjectT{AdoptGlobal{}, PromotedLocalObject<class_v>(
+                                              std::forward<Params>(params)...)};
+    }
+  }
+
+ private:
+  template <const auto& class_v, typename... Params>
+  jobject PromotedLocalObject(Params&&... params) {
     LocalObject obj =
         BuildLocalObject<class_v>(std::forward<Params>(params)...);
-    jobject promoted_local =
-        LifecycleHelper<jobject, LifecycleType::GLOBAL>::Promote(obj.Release());
 
-    return GlobalObject<class_v,
-                        ParentLoaderForClass<class_loader_v_, class_v>(),
-                        JvmForLoader<class_v>()>{AdoptGlobal{}, promoted_local};
+    return LifecycleHelper<jobject, LifecycleType::GLOBAL>::Promote(
+        obj.Release());
   }
 };
 
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cstddef>
 #include <utility>
 
 #include <gmock/gmock.h>
@@ -32,8 +33,10 @@ using ::jni::GlobalClassLoader;
 using ::jni::Jvm;
 using ::jni::JvmRef;
 using ::jni::kDefaultJvm;
+using ::jni::kMaxLoaderInstances;
 using ::jni::kNullClassLoader;
 using ::jni::LocalClassLoader;
+using ::jni::LoaderInstanceOverflows;
 using ::jni::LocalObject;
 using ::jni::Method;
 using ::jni::Params;
@@ -275,9 +278,6 @@ TEST_F(JniTestWithNoDefaultJvmRef,
   EXPECT_CALL(*env_, FindClass(StrEq("java/lang/Class")))
       .WillOnce(testing::Return(Fake<jclass>(2)));
 
-  EXPECT_CALL(*env_, FindClass(StrEq("java/lang/ClassLoader")))
-      .WillOnce(testing::Return(Fake<jclass>(3)));
-
   EXPECT_CALL(*env_, GetObjectClass(Fake<jobject>(1)))
       .WillOnce(testing::Return(Fake<jclass>(1)));
 
@@ -289,6 +289,9 @@ TEST_F(JniTestWithNoDefaultJvmRef,
   EXPECT_CALL(*env_, CallObjectMethodV(Fake<jclass>(1), Fake<jmethodID>(2), _))
       .WillOnce(testing::Return(Fake<jobject>(3)));
 
+  EXPECT_CALL(*env_, FindClass(StrEq("java/lang/ClassLoader")))
+      .WillOnce(testing::Return(Fake<jclass>(3)));
+
   EXPECT_CALL(*env_,
               GetMethodID(Eq(AsGlobal(Fake<jclass>(3))), StrEq("loadClass"),
                           StrEq("(Ljava/lang/String;)Ljava/lang/Class;")))
@@ -319,4 +322,236 @@ TEST_F(JniTestWithNoDefaultJvmRef,
   this->TearDown();
 }
 
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_LoadingFromObjectsReusesReflectionIds) {
+  static constexpr Class class_a{"com/google/LoadedA",
+                                 Method{"Foo", jni::Return{}}};
+  static constexpr Class class_b{"com/google/LoadedB",
+                                 Method{"Foo", jni::Return{}}};
+  static constexpr ClassLoader class_loader{
+      kNullClassLoader, SupportedClassSet{class_a, class_b}};
+  static constexpr jni::Jvm atypical_jvm_definition{class_loader};
+
+  EXPECT_CALL(*env_, FindClass).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+
+  // Both classes are resolved with a single `loadClass` call each.
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("getClassLoader"),
+                                 StrEq("()Ljava/lang/ClassLoader;")))
+      .Times(1);
+  EXPECT_CALL(*env_,
+              GetMethodID(_, StrEq("loadClass"),
+                          StrEq("(Ljava/lang/String;)Ljava/lang/Class;")))
+      .Times(1);
+  EXPECT_CALL(*env_, NewStringUTF(StrEq("com.google.LoadedA"))).Times(1);
+  EXPECT_CALL(*env_, NewStringUTF(StrEq("com.google.LoadedB"))).Times(1);
+
+  jni::JvmRef<atypical_jvm_definition> jvm_ref{jvm_.get(),
+                                               kDefaultConfiguration};
+  jni::LocalObject<class_a, class_loader, atypical_jvm_definition> obj_a{
+      AdoptLocal{}, Fake<jobject>(1)};
+  jni::LocalObject<class_b, class_loader, atypical_jvm_definition> obj_b{
+      AdoptLocal{}, Fake<jobject>(2)};
+  obj_a.Call<"Foo">();
+  obj_b.Call<"Foo">();
+
+  this->TearDown();
+}
+
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_LoaderInstancesCacheIdsAgainstTheirOwnClass) {
+  static constexpr Class class_under_test{"com/google/Plugin",
+                                          Constructor{},
+                                          Method{"Foo", jni::Return{}}};
+  static constexpr ClassLoader class_loader{
+      kNullClassLoader, SupportedClassSet{class_under_test}};
+  static constexpr jni::Jvm atypical_jvm_definition{class_loader};
+
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+
+  // Each loader instance loads its own class. Both are held weakly.
+  ON_CALL(*env_, NewWeakGlobalRef).WillByDefault([](jobject object) {
+    return object;
+  });
+  ON_CALL(*env_, IsSameObject)
+      .WillByDefault([](jobject lhs, jobject rhs) -> jboolean {
+        return lhs == rhs || lhs == AsGlobal(rhs) || AsGlobal(lhs) == rhs;
+      });
+  ON_CALL(*env_, CallObjectMethodV(Fake<jobject>(1), _, _))
+      .WillByDefault(::testing::Return(Fake<jobject>(10)));
+  ON_CALL(*env_, CallObjectMethodV(Fake<jobject>(2), _, _))
+      .WillByDefault(::testing::Return(Fake<jobject>(11)));
+
+  // IDs are looked up once per loaded class, however many objects are built.
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(10)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .Times(1);
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(11)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .Times(1);
+
+  jni::JvmRef<atypical_jvm_definition> jvm_ref{jvm_.get(),
+                                               kDefaultConfiguration};
+  LocalClassLoader<class_loader, atypical_jvm_definition> loader_1{
+      AdoptLocal{}, Fake<jobject>(1)};
+  LocalClassLoader<class_loader, atypical_jvm_definition> loader_2{
+      AdoptLocal{}, Fake<jobject>(2)};
+
+  for (int i = 0; i < 2; ++i) {
+    loader_1.BuildLocalObject<class_under_test>().Call<"Foo">();
+    loader_2.BuildLocalObject<class_under_test>().Call<"Foo">();
+  }
+
+  default_globals_made_that_should_be_released_.clear();
+  TearDown();
+}
+
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_CollectedLoaderInstancesAreReclaimed) {
+  static constexpr Class class_under_test{"com/google/Plugin",
+                                          Constructor{},
+                                          Method{"Foo", jni::Return{}}};
+  static constexpr ClassLoader class_loader{
+      kNullClassLoader, SupportedClassSet{class_under_test}};
+  static constexpr jni::Jvm atypical_jvm_definition{class_loader};
+
+  bool loader_1_collected = false;
+
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteWeakGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+
+  ON_CALL(*env_, NewWeakGlobalRef).WillByDefault([](jobject object) {
+    return object;
+  });
+  ON_CALL(*env_, IsSameObject)
+      .WillByDefault([&](jobject lhs, jobject rhs) -> jboolean {
+        if (rhs == nullptr) {
+          return lhs == Fake<jobject>(1) && loader_1_collected;
+        }
+        return lhs == rhs;
+      });
+  // Once the first loader is gone, its class's handle is reused by the
+  // second's.
+  ON_CALL(*env_, CallObjectMethodV(Fake<jobject>(1), _, _))
+      .WillByDefault(::testing::Return(Fake<jobject>(10)));
+  ON_CALL(*env_, CallObjectMethodV(Fake<jobject>(2), _, _))
+      .WillByDefault(::testing::Return(Fake<jobject>(10)));
+
+  // IDs cached against the collected loader's class are not reused.
+  EXPECT_CALL(*env_, DeleteWeakGlobalRef(Fake<jobject>(1))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(10)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .Times(2);
+
+  jni::JvmRef<atypical_jvm_definition> jvm_ref{jvm_.get(),
+                                               kDefaultConfiguration};
+  {
+    LocalClassLoader<class_loader, atypical_jvm_definition> loader_1{
+        AdoptLocal{}, Fake<jobject>(1)};
+    loader_1.BuildLocalObject<class_under_test>().Call<"Foo">();
+  }
+
+  loader_1_collected = true;
+
+  LocalClassLoader<class_loader, atypical_jvm_definition> loader_2{
+      AdoptLocal{}, Fake<jobject>(2)};
+  loader_2.BuildLocalObject<class_under_test>().Call<"Foo">();
+
+  default_globals_made_that_should_be_released_.clear();
+  TearDown();
+}
+
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_ObjectsFromJavaUseTheirOwnLoadersClass) {
+  static constexpr Class class_under_test{"com/google/Plugin",
+                                          Method{"Foo", jni::Return{}}};
+  static constexpr ClassLoader class_loader{
+      kNullClassLoader, SupportedClassSet{class_under_test}};
+  static constexpr jni::Jvm atypical_jvm_definition{class_loader};
+
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+
+  ON_CALL(*env_, NewWeakGlobalRef).WillByDefault([](jobject object) {
+    return object;
+  });
+  ON_CALL(*env_, IsSameObject)
+      .WillByDefault([](jobject lhs, jobject rhs) -> jboolean {
+        return lhs == rhs || lhs == AsGlobal(rhs) || AsGlobal(lhs) == rhs;
+      });
+
+  // Neither object was built by a `ClassLoaderRef`, and each is from a
+  // different instance of the loader.
+  ON_CALL(*env_, GetObjectClass(Fake<jobject>(1)))
+      .WillByDefault(::testing::Return(Fake<jclass>(5)));
+  ON_CALL(*env_, GetObjectClass(Fake<jobject>(2)))
+      .WillByDefault(::testing::Return(Fake<jclass>(6)));
+  ON_CALL(*env_, CallObjectMethodV(Fake<jclass>(5), _, _))
+      .WillByDefault(::testing::Return(Fake<jobject>(7)));
+  ON_CALL(*env_, CallObjectMethodV(Fake<jclass>(6), _, _))
+      .WillByDefault(::testing::Return(Fake<jobject>(8)));
+  ON_CALL(*env_, CallObjectMethodV(Fake<jobject>(7), _, _))
+      .WillByDefault(::testing::Return(Fake<jobject>(10)));
+  ON_CALL(*env_, CallObjectMethodV(Fake<jobject>(8), _, _))
+      .WillByDefault(::testing::Return(Fake<jobject>(11)));
+
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(10)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .Times(1);
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(11)), StrEq("Foo"),
+                                 StrEq("()V")))
+      .Times(1);
+
+  jni::JvmRef<atypical_jvm_definition> jvm_ref{jvm_.get(),
+                                               kDefaultConfiguration};
+  LocalObject<class_under_test, class_loader, atypical_jvm_definition> obj_1{
+      AdoptLocal{}, Fake<jobject>(1)};
+  LocalObject<class_under_test, class_loader, atypical_jvm_definition> obj_2{
+      AdoptLocal{}, Fake<jobject>(2)};
+  obj_1.Call<"Foo">();
+  obj_2.Call<"Foo">();
+
+  default_globals_made_that_should_be_released_.clear();
+  TearDown();
+}
+
+TEST_F(JniTestWithNoDefaultJvmRef,
+       ClassLoaderRefTest_LoaderInstancesBeyondTheLimitAreReported) {
+  static constexpr Class class_under_test{"com/google/Plugin", Constructor{}};
+  static constexpr ClassLoader class_loader{
+      kNullClassLoader, SupportedClassSet{class_under_test}};
+  static constexpr jni::Jvm atypical_jvm_definition{class_loader};
+
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+
+  // No loader is ever collected, so every entry stays taken.
+  ON_CALL(*env_, NewWeakGlobalRef).WillByDefault([](jobject object) {
+    return object;
+  });
+  ON_CALL(*env_, IsSameObject)
+      .WillByDefault([](jobject lhs, jobject rhs) -> jboolean {
+        return lhs == rhs;
+      });
+  ON_CALL(*env_, CallObjectMethodV)
+      .WillByDefault(::testing::Return(Fake<jobject>(20)));
+
+  jni::JvmRef<atypical_jvm_definition> jvm_ref{jvm_.get(),
+                                               kDefaultConfiguration};
+  const std::size_t overflows_before = LoaderInstanceOverflows().load();
+  for (std::size_t i = 1; i <= kMaxLoaderInstances + 1; ++i) {
+    LocalClassLoader<class_loader, atypical_jvm_definition> loader{
+        AdoptLocal{}, Fake<jobject>(static_cast<int>(i))};
+    loader.BuildLocalObject<class_under_test>();
+  }
+
+  // Only the instance beyond the limit shares the fallback class.
+  EXPECT_EQ(LoaderInstanceOverflows().load() - overflows_before, 1);
+
+  default_globals_made_that_should_be_released_.clear();
+  TearDown();
+}
+
 }  // namespace
@@ -19,10 +19,18 @@
 
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "class_defs/java_lang_classes.h"
+#include "implementation/class_keyed_map.h"
 #include "implementation/configuration.h"
 #include "implementation/default_class_loader.h"
 #include "implementation/jni_helper/invoke.h"
@@ -33,12 +41,19 @@
 #include "implementation/jni_type.h"
 #include "implementation/ref_storage.h"
 #include "implementation/selector_static_info.h"
+#include "implementation/startup_profile.h"
 #include "jni_dep.h"
 #include "metaprogramming/double_locked_value.h"
 
 namespace jni {
 
-static inline jclass LoadClassFromObject(const char* name, jobject object_ref);
+static inline jobject ClassLoaderOfObject(jobject object_ref);
+static inline jclass LoadClassFromLoader(
+    const char* name, metaprogramming::DoubleLockedValue<jstring>& name_string,
+    jobject class_loader);
+static inline jclass LoadClassFromObject(
+    const char* name, metaprogramming::DoubleLockedValue<jstring>& name_string,
+    jobject object_ref);
 
 // Represents a a jclass instance for a specific class. 4 flavours exist:
 //   1) Default JVM, default class loader.
@@ -47,24 +62,44 @@ static inline jclass LoadClassFromObject(const char* name, jobject object_ref);
 //   4) Non-default JVM, non default class loader (i.e. fully specified).
 //
 // Use |ClassRef_t| to provide |JniT| in its minimal form.
+//
+// For non-default class loaders, several runtime instances of the same loader
+// (e.g. two versions of a plugin) may each load the class. Up to
+// `kMaxLoaderInstances` live instances, whether they build objects or only
+// pass them in from Java, get their own `jclass`, and IDs are cached against
+// that `jclass` (see `IdTable`). These are held weakly so that unloading a
+// loader frees its entry for another. Instances beyond the limit share one
+// `jclass`, which may belong to another instance, so this is reported.
+//
+// IDs keyed by a `jclass` are erased before it is deleted (see
+// `EraseFromClassKeyedMaps`).
 template <typename JniT>
 class ClassRef {
  public:
   static_assert(std::is_same_v<JniT, typename JniT::MinimallySpanningType>,
                 "JniT must be in its minimal form for best caching.");
 
-  template <typename Lambda>
-  static void PrimeJClassFromClassLoader(Lambda lambda) {
-    class_ref_.LoadAndMaybeInit(lambda);
+  // Key and entry for `StartupProfile` (default class loader, rank 0 only).
+  static constexpr std::string_view kProfileKey = JniT::kName;
+
+  static StartupProfileEntry ProfileEntry() {
+    return {JniT::kName.data(), "", "",
+            +[]() { return GetAndMaybeLoadClassRef(nullptr); }, nullptr};
   }
 
   static jclass GetAndMaybeLoadClassRef(
       jobject optional_object_to_build_loader_from) {
     // For the default classloader, storage in uniquely IDed struct static.
     if constexpr (JniT::GetClassLoader() == kDefaultClassLoader) {
+      if constexpr (JniT::kRank == 0) {
+        static_cast<void>(StartupProfileRegistration<ClassRef>::kRegistered);
+      }
+
       static auto get_lambda =
           [](metaprogramming::DoubleLockedValue<jclass>* storage) {
             if (kConfiguration.release_class_ids_on_teardown_) {
+              std::lock_guard<std::mutex> lock_guard{
+                  DefaultRefsLock<jclass>()};
               DefaultRefs<jclass>().push_back(storage);
             }
 
@@ -72,9 +107,15 @@ class ClassRef {
             // class names when used in arrays (e.g. "[LkClass;"). This doesn't
             // come up in the API until rank 2.
             if constexpr (JniT::kRank <= 1) {
-              return static_cast<jclass>(
+              jclass clazz = static_cast<jclass>(
                   LifecycleHelper<jobject, LifecycleType::GLOBAL>::Promote(
                       JniHelper::FindClass(JniT::kName.data())));
+
+              if (JniT::kRank == 0 && clazz != nullptr) {
+                StartupProfile::MaybeRecord(kProfileKey);
+              }
+
+              return clazz;
             } else {
               // Primitive types drop their rank by 1 because of how their
               // signatures get derived in array_ref.h.
@@ -95,14 +136,123 @@ class ClassRef {
           decltype(get_lambda),
           SelectorStaticInfo<JniTSelector<JniT, 0, 0>>>::Get(get_lambda);
     } else {
+      // Objects under construction by a loader use that loader's class.
+      if (jclass building_class_ref = BuildingClassRef()) {
+        return building_class_ref;
+      }
+
+      // An object's own loader decides which loader instance's class it is
+      // an instance of. This holds even for objects that arrive from Java
+      // before any `ClassLoaderRef` has built one, so it is always checked.
+      if (optional_object_to_build_loader_from != nullptr) {
+        jobject class_loader =
+            ClassLoaderOfObject(optional_object_to_build_loader_from);
+        jclass ret = GetAndMaybeLoadClassRefForLoader(class_loader, [=]() {
+          return LoadClassFromLoader(JniT::kNameWithDots.data(), name_string_,
+                                     class_loader);
+        });
+        LifecycleHelper<jobject, LifecycleType::LOCAL>::Delete(class_loader);
+
+        return ret;
+      }
+
       // For non default classloader, storage in class member.
       return class_ref_.LoadAndMaybeInit([=]() {
-        return LoadClassFromObject(JniT::kNameWithDots.data(),
+        return LoadClassFromObject(JniT::kNameWithDots.data(), name_string_,
                                    optional_object_to_build_loader_from);
       });
     }
   }
 
+  // Returns the `jclass` for the runtime loader instance `class_loader`,
+  // invoking `lambda` to load it (as a global) if this instance has none yet.
+  // Instances are told apart with `IsSameObject`, so this is only used once
+  // per object (see `LoaderClassMemo`), not on every call. As weak references
+  // can only be compared through JNI, the scan and the reclaiming of collected
+  // loaders are guarded by a lock. IDs are then found without one, keyed by
+  // the returned `jclass` (see `ClassKeyedMap`).
+  //
+  // If all `kMaxLoaderInstances` entries are held by live loaders, further
+  // instances share `class_ref_`, which was loaded by whichever instance first
+  // used it. This is reported once (see `LoaderInstanceOverflows`).
+  //
+  // The returned `jclass` is a weak global, as a global would keep its loader
+  // alive forever. It is valid for as long as `class_loader` is.
+  template <typename Lambda>
+  static jclass GetAndMaybeLoadClassRefForLoader(jobject class_loader,
+                                                 Lambda lambda) {
+    LoaderInstance* loader_instance = nullptr;
+    bool exhausted = false;
+    {
+      std::lock_guard<std::mutex> lock_guard{LoaderInstancesLock()};
+
+      LoaderInstance* free_instance = nullptr;
+      for (LoaderInstance& instance : loader_instances_) {
+        if (instance.class_loader == nullptr) {
+          free_instance = free_instance ? free_instance : &instance;
+        } else if (JniHelper::IsSameObject(instance.class_loader,
+                                           class_loader)) {
+          loader_instance = &instance;
+          break;
+        } else if (JniHelper::IsSameObject(instance.class_loader, nullptr)) {
+          // The loader was collected, so its class can't be in use.
+          ReleaseLoaderInstance(instance);
+          free_instance = free_instance ? free_instance : &instance;
+        }
+      }
+
+      if (!loader_instance && free_instance) {
+        free_instance->class_loader = JniHelper::NewWeakGlobalRef(class_loader);
+        if (free_instance->class_loader != nullptr) {
+          loader_instance = free_instance;
+        }
+      }
+
+      exhausted = !loader_instance && !free_instance;
+    }
+
+    // Every entry is taken (or can't be held), so fall back to the class
+    // shared by all loaders.
+    if (!loader_instance) {
+      if (exhausted) {
+        FlagLoaderInstanceOverflow();
+      }
+      return class_ref_.LoadAndMaybeInit(lambda);
+    }
+
+    // The caller's reference to `class_loader` prevents this entry from being
+    // released while the class is loaded outside of the lock.
+    return loader_instance->class_ref.LoadAndMaybeInit([&]() {
+      jclass clazz = lambda();
+      jclass weak_clazz =
+          static_cast<jclass>(JniHelper::NewWeakGlobalRef(clazz));
+      LifecycleHelper<jclass, LifecycleType::GLOBAL>::Delete(clazz);
+
+      return weak_clazz;
+    });
+  }
+
+  // While in scope, objects of this class built on this thread use `clazz`,
+  // the class of the loader instance building them (see `ClassLoaderRef`).
+  class BuildScope {
+   public:
+    explicit BuildScope(jclass clazz)
+        : previous_(std::exchange(BuildingClassRef(), clazz)) {}
+    ~BuildScope() { BuildingClassRef() = previous_; }
+
+    BuildScope(const BuildScope&) = delete;
+    BuildScope& operator=(const BuildScope&) = delete;
+
+   private:
+    const jclass previous_;
+  };
+
+  // The class set by the innermost `BuildScope` on this thread, or null.
+  static jclass& BuildingClassRef() {
+    static thread_local jclass building_class_ref = nullptr;
+    return building_class_ref;
+  }
+
   static jclass GetAlreadyLoadedClassRef() {
     return class_ref_.LoadAndMaybeInit([]() { return jclass{0}; });
   }
@@ -110,9 +260,22 @@ class ClassRef {
   static void MaybeReleaseClassRef() {
     if (kConfiguration.release_class_ids_on_teardown_) {
       class_ref_.Reset([](jclass maybe_loaded_class) {
+        if constexpr (JniT::GetClassLoader() != kDefaultClassLoader) {
+          EraseFromClassKeyedMaps(maybe_loaded_class);
+        }
         LifecycleHelper<jclass, LifecycleType::GLOBAL>::Delete(
             maybe_loaded_class);
       });
+      name_string_.Reset([](jstring name_string) {
+        LifecycleHelper<jstring, LifecycleType::GLOBAL>::Delete(name_string);
+      });
+
+      if constexpr (JniT::GetClassLoader() != kDefaultClassLoader) {
+        std::lock_guard<std::mutex> lock_guard{LoaderInstancesLock()};
+        for (LoaderInstance& instance : loader_instances_) {
+          ReleaseLoaderInstance(instance);
+        }
+      }
     }
   }
 
@@ -121,56 +284,141 @@ class ClassRef {
   // The variable has static storage because ClassIDs are static to the lifetime
   // of a JVM.  See GetAndMaybeLoadClassRef and MaybeReleaseClassRef.
   static inline metaprogramming::DoubleLockedValue<jclass> class_ref_;
+
+  // A global reference to the class name (with dots), interned on first use by
+  // LoadClassFromObject.
+  static inline metaprogramming::DoubleLockedValue<jstring> name_string_;
+
+  // A loader instance and the `jclass` it loaded, both held weakly.
+  // `class_loader` is guarded by `LoaderInstancesLock`.
+  struct LoaderInstance {
+    jweak class_loader = nullptr;
+    metaprogramming::DoubleLockedValue<jclass> class_ref;
+  };
+
+  // Forgets the IDs of `instance`'s class and frees the entry. Must be called
+  // with `LoaderInstancesLock` held.
+  static void ReleaseLoaderInstance(LoaderInstance& instance) {
+    instance.class_ref.Reset([](jclass weak_loaded_class) {
+      EraseFromClassKeyedMaps(weak_loaded_class);
+      JniHelper::DeleteWeakGlobalRef(weak_loaded_class);
+    });
+
+    if (instance.class_loader != nullptr) {
+      JniHelper::DeleteWeakGlobalRef(
+          std::exchange(instance.class_loader, nullptr));
+    }
+  }
+
+  static std::mutex& LoaderInstancesLock() {
+    static auto* ret_val = new std::mutex{};
+    return *ret_val;
+  }
+
+  // Non-default loaders only, see `GetAndMaybeLoadClassRefForLoader`.
+  static inline std::array<LoaderInstance, kMaxLoaderInstances>
+      loader_instances_;
 };
 
-// When we get an object_ref_ as a return value from a Java method, it may be
-// an instance of a subclass of ClassRefT. In this case, if we directly used
-// the object_ref_'s class, then we might incorrectly get member information
-// for the subclass instead of the original class. However, the original class
-// should still be loadable from the subclass's class loader, so we load the
-// ClassRef explicitly by class name.
-static inline jclass LoadClassFromObject(const char* name, jobject object_ref) {
+// Fully qualified IDs of the reflection methods used by LoadClassFromObject,
+// see `OverloadRefUniqueId`.
+struct GetClassLoaderUniqueId {
+  static constexpr std::string_view TypeName() {
+    return "java/lang/Class#getClassLoader#()Ljava/lang/ClassLoader;";
+  }
+};
+
+struct LoadClassUniqueId {
+  static constexpr std::string_view TypeName() {
+    return "java/lang/ClassLoader#loadClass#"
+           "(Ljava/lang/String;)Ljava/lang/Class;";
+  }
+};
+
+// Returns a local to the class loader of `object_ref`'s class.
+static inline jobject ClassLoaderOfObject(jobject object_ref) {
   // We cannot refer to the wrapper MethodRefs here, so we just manually use
-  // the class loader through JNI.
+  // the class loader through JNI. The method IDs are cached like any other.
+  const std::uint32_t generation =
+      IdGeneration<jmethodID>().load(std::memory_order_relaxed);
 
   // Gets the ClassLoader of java/lang/class (the primordial loader).
   // Note, these aren't static methods, they're member methods to be invoked
-  // on the object's class itself.  The class may not have been loaded yet,
-  // and all you have is a jobject
+  // on the object's class.
   jclass java_lang_class_jclass =
       ClassRef<JniT<jobject, kJavaLangClass>>::GetAndMaybeLoadClassRef(nullptr);
 
-  jclass java_lang_class_loader_jclass =
-      ClassRef<JniT<jobject, kJavaLangClassLoader>>::GetAndMaybeLoadClassRef(
-          nullptr);
-
   jclass class_of_object_jclass = JniHelper::GetObjectClass(object_ref);
 
-  jmethodID get_class_loader_jmethod = JniHelper::GetMethodID(
-      java_lang_class_jclass, "getClassLoader", "()Ljava/lang/ClassLoader;");
+  auto get_class_loader_lambda =
+      [=](metaprogramming::DoubleLockedValue<jmethodID>*) {
+        return JniHelper::GetMethodID(java_lang_class_jclass, "getClassLoader",
+                                      "()Ljava/lang/ClassLoader;");
+      };
+  jmethodID get_class_loader_jmethod =
+      RefStorage<decltype(get_class_loader_lambda),
+                 GetClassLoaderUniqueId>::Get(get_class_loader_lambda,
+                                              generation);
 
   jobject object_ref_class_loader_jobject =
       InvokeHelper<jobject, 1, false>::Invoke(class_of_object_jclass, nullptr,
                                               get_class_loader_jmethod);
 
+  LifecycleHelper<jobject, LifecycleType::LOCAL>::Delete(
+      class_of_object_jclass);
+
+  return object_ref_class_loader_jobject;
+}
+
+// Loads `name` with `class_loader` and returns it as a global.
+//
+// `name` is interned as a global jstring in `name_string` on first use.
+static inline jclass LoadClassFromLoader(
+    const char* name, metaprogramming::DoubleLockedValue<jstring>& name_string,
+    jobject class_loader) {
+  const std::uint32_t generation =
+      IdGeneration<jmethodID>().load(std::memory_order_relaxed);
+
+  jclass java_lang_class_loader_jclass =
+      ClassRef<JniT<jobject, kJavaLangClassLoader>>::GetAndMaybeLoadClassRef(
+          nullptr);
+
+  auto load_class_lambda =
+      [=](metaprogramming::DoubleLockedValue<jmethodID>*) {
+        return JniHelper::GetMethodID(java_lang_class_loader_jclass,
+                                      "loadClass",
+                                      "(Ljava/lang/String;)Ljava/lang/Class;");
+      };
   jmethodID load_class_jmethod =
-      JniHelper::GetMethodID(java_lang_class_loader_jclass, "loadClass",
-                             "(Ljava/lang/String;)Ljava/lang/Class;");
+      RefStorage<decltype(load_class_lambda), LoadClassUniqueId>::Get(
+          load_class_lambda, generation);
 
-  jstring name_string =
-      LifecycleHelper<jstring, LifecycleType::LOCAL>::Construct(name);
+  jstring name_jstring = name_string.LoadAndMaybeInit([=]() {
+    return LifecycleHelper<jstring, LifecycleType::GLOBAL>::Construct(name);
+  });
   jobject local_jclass_of_correct_loader =
-      InvokeHelper<jobject, 1, false>::Invoke(object_ref_class_loader_jobject,
-                                              nullptr, load_class_jmethod,
-                                              name_string);
-  jobject promote_jclass_of_correct_loader =
+      InvokeHelper<jobject, 1, false>::Invoke(class_loader, nullptr,
+                                              load_class_jmethod, name_jstring);
+
+  return static_cast<jclass>(
       LifecycleHelper<jobject, LifecycleType::GLOBAL>::Promote(
-          local_jclass_of_correct_loader);
+          local_jclass_of_correct_loader));
+}
 
-  LifecycleHelper<jobject, LifecycleType::LOCAL>::Delete(
-      object_ref_class_loader_jobject);
+// When we get an object_ref_ as a return value from a Java method, it may be
+// an instance of a subclass of ClassRef. In this case, if we directly used
+// the object_ref_'s class, then we would incorrectly get the ClassRef
+// for the subclass instead of the original class. However, the original class
+// should still be loadable from the subclass's class loader, so we load the
+// ClassRef explicitly by class name.
+static inline jclass LoadClassFromObject(
+    const char* name, metaprogramming::DoubleLockedValue<jstring>& name_string,
+    jobject object_ref) {
+  jobject class_loader = ClassLoaderOfObject(object_ref);
+  jclass ret = LoadClassFromLoader(name, name_string, class_loader);
+  LifecycleHelper<jobject, LifecycleType::LOCAL>::Delete(class_loader);
 
-  return static_cast<jclass>(promote_jclass_of_correct_loader);
+  return ret;
 }
 
 template <typename JniT>
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_IMPLEMENTATION_CONSTRUCT_ALL_H_
+#define JNI_BIND_IMPLEMENTATION_CONSTRUCT_ALL_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include "implementation/class_ref.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/id.h"
+#include "implementation/id_type.h"
+#include "implementation/invoke_all.h"
+#include "implementation/jni_helper/jni_array_helper.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_type.h"
+#include "implementation/jvm.h"
+#include "implementation/local_array.h"
+#include "implementation/method_selection.h"
+#include "implementation/no_idx.h"
+#include "jni_dep.h"
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif  // __cplusplus >= 202002L
+
+namespace jni {
+
+#if __cplusplus >= 202002L
+// Builds an array of `size` objects of `class_v`, where element `i` is
+// constructed from `columns[i]...`.  The constructor is selected from the
+// column types exactly as arguments to `LocalObject`'s constructor would, and
+// its jclass and jmethodID are resolved once for the whole array.  Objects are
+// built within local frames of `kInvokeAllFrameSize` elements, so large arrays
+// do not exhaust the local reference table.
+//
+// Every column must hold at least `size` elements.
+//
+// If the array or a local frame can't be allocated, or a constructor throws,
+// no further objects are constructed and the exception is left pending.  The
+// returned array is then only partially filled (or null).
+//
+//   std::vector<jint> ids = ...;
+//   std::vector<jfloat> scores = ...;
+//   LocalArray<jobject, 1, kRecord> records =
+//       ConstructAll<kRecord>(ids.size(), std::span{ids}, std::span{scores});
+template <const auto& class_v, typename... Ts>
+LocalArray<jobject, 1, class_v> ConstructAll(std::size_t size,
+                                             std::span<Ts>... columns) {
+  using JniT_ = JniT<jobject, class_v, kDefaultClassLoader, kDefaultJvm>;
+  using IdT = Id<JniT_, IdType::OVERLOAD_SET, kNoIdx, kNoIdx, kNoIdx, 0>;
+  using ConstructorSelection =
+      OverloadSelector<IdT, IdType::OVERLOAD, IdType::OVERLOAD_PARAM,
+                       std::remove_cv_t<Ts>...>;
+  static_assert(ConstructorSelection::kIsValidArgSet,
+                "No constructor matches the column types.");
+
+  using OverloadRefT = typename ConstructorSelection::_OverloadRef;
+
+  assert(((columns.size() >= size) && ...));
+
+  jclass clazz = ClassRef_t<JniT_>::GetAndMaybeLoadClassRef(nullptr);
+  jmethodID constructor = OverloadRefT::GetMethodID(clazz);
+
+  LocalArray<jobject, 1, class_v> ret{size};
+  jobjectArray array = static_cast<jobjectArray>(static_cast<jobject>(ret));
+  if (array == nullptr) {
+    return ret;
+  }
+
+  for (std::size_t start = 0; start < size; start += kInvokeAllFrameSize) {
+    const std::size_t end = std::min(size, start + kInvokeAllFrameSize);
+    if (JniHelper::PushLocalFrame(static_cast<jint>(end - start)) != JNI_OK) {
+      break;
+    }
+
+    bool threw = false;
+    for (std::size_t i = start; i < end; ++i) {
+      jobject obj = OverloadRefT::ConstructWithMethodID(clazz, constructor,
+                                                        columns[i]...);
+      if ((threw = JniHelper::ExceptionCheck())) {
+        break;
+      }
+
+      JniArrayHelper<jobject, 1>::SetArrayElement(array, i, obj);
+    }
+
+    JniHelper::PopLocalFrame(nullptr);
+
+    if (threw) {
+      break;
+    }
+  }
+
+  return ret;
+}
+#endif  // __cplusplus >= 202002L
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_CONSTRUCT_ALL_H_
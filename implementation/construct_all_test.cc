@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <span>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::ConstructAll;
+using ::jni::Constructor;
+using ::jni::Fake;
+using ::jni::kInvokeAllFrameSize;
+using ::jni::LocalArray;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::StrEq;
+
+static constexpr Class kClass{
+    "kClass",
+    Constructor{},
+    Constructor<jint, jfloat>{},
+};
+
+TEST_F(JniTest, ConstructAll_ResolvesConstructorOnce) {
+  const std::size_t kSize = kInvokeAllFrameSize + 1;
+  std::vector<jint> ints(kSize, 1);
+  std::vector<jfloat> floats(kSize, 2.f);
+
+  EXPECT_CALL(*env_, NewObjectArray(kSize, _, nullptr))
+      .WillOnce(testing::Return(Fake<jobjectArray>()));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("<init>"), StrEq("(IF)V")))
+      .Times(1);
+  EXPECT_CALL(*env_, NewObjectV)
+      .Times(kSize)
+      .WillRepeatedly(testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_,
+              SetObjectArrayElement(Fake<jobjectArray>(), _, Fake<jobject>(2)))
+      .Times(kSize);
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2))).Times(0);
+  {
+    InSequence seq;
+    EXPECT_CALL(*env_, PushLocalFrame(kInvokeAllFrameSize));
+    EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+    EXPECT_CALL(*env_, PushLocalFrame(1));
+    EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+  }
+
+  LocalArray<jobject, 1, kClass> arr =
+      ConstructAll<kClass>(kSize, std::span{ints}, std::span{floats});
+}
+
+TEST_F(JniTest, ConstructAll_PassesEachRowOfColumns) {
+  const std::vector<jint> ints{1, 2};
+  const std::vector<jfloat> floats{3.f, 4.f};
+
+  EXPECT_CALL(*env_, SetObjectArrayElement(_, 0, _));
+  EXPECT_CALL(*env_, SetObjectArrayElement(_, 1, _));
+  EXPECT_CALL(*env_, NewObjectV)
+      .WillOnce([](jclass, jmethodID, va_list args) {
+        EXPECT_EQ(va_arg(args, jint), 1);
+        EXPECT_EQ(va_arg(args, jdouble), 3.);
+        return Fake<jobject>(1);
+      })
+      .WillOnce([](jclass, jmethodID, va_list args) {
+        EXPECT_EQ(va_arg(args, jint), 2);
+        EXPECT_EQ(va_arg(args, jdouble), 4.);
+        return Fake<jobject>(2);
+      });
+
+  ConstructAll<kClass>(2, std::span{ints}, std::span{floats});
+}
+
+TEST_F(JniTest, ConstructAll_SupportsDefaultConstructors) {
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("<init>"), StrEq("()V")));
+  EXPECT_CALL(*env_, NewObjectV).Times(3);
+  EXPECT_CALL(*env_, PushLocalFrame(3));
+  EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+
+  ConstructAll<kClass>(3);
+}
+
+TEST_F(JniTest, ConstructAll_StopsAtTheFirstException) {
+  EXPECT_CALL(*env_, NewObjectV)
+      .WillOnce(testing::Return(Fake<jobject>(1)))
+      .WillOnce(testing::Return(nullptr));
+  EXPECT_CALL(*env_, ExceptionCheck)
+      .WillOnce(testing::Return(JNI_FALSE))
+      .WillOnce(testing::Return(JNI_TRUE));
+  EXPECT_CALL(*env_, SetObjectArrayElement(_, 0, Fake<jobject>(1)));
+  EXPECT_CALL(*env_, SetObjectArrayElement(_, 1, _)).Times(0);
+  EXPECT_CALL(*env_, PushLocalFrame(3));
+  EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+
+  ConstructAll<kClass>(3);
+}
+
+TEST_F(JniTest, ConstructAll_DoesNothingIfTheLocalFrameCantBePushed) {
+  EXPECT_CALL(*env_, PushLocalFrame(3)).WillOnce(testing::Return(JNI_ERR));
+  EXPECT_CALL(*env_, NewObjectV).Times(0);
+  EXPECT_CALL(*env_, SetObjectArrayElement).Times(0);
+  EXPECT_CALL(*env_, PopLocalFrame).Times(0);
+
+  ConstructAll<kClass>(3);
+}
+
+}  // namespace
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_CRITICAL_ARRAY_VIEW_H_
+#define JNI_BIND_IMPLEMENTATION_CRITICAL_ARRAY_VIEW_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include "implementation/jni_helper/jni_array_helper.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Counters for `CriticalArrayView`. These are only collected in debug builds
+// (i.e. without `NDEBUG`), as timing each region costs two clock reads and
+// several shared atomic updates per pin. In release builds they stay zero.
+struct CriticalRegionStats {
+  // Critical regions closed so far.
+  std::size_t count;
+
+  // Total and longest time spent inside a critical region. Long regions stall
+  // the garbage collector, so `max_duration` is the one to watch.
+  std::chrono::nanoseconds total_duration;
+  std::chrono::nanoseconds max_duration;
+};
+
+// Timing shared by every `CriticalArrayView`, regardless of `SpanType`.
+class CriticalArrayViewBase {
+ public:
+  static CriticalRegionStats GetStats() {
+    return {Count().load(std::memory_order_relaxed),
+            std::chrono::nanoseconds{
+                TotalNanos().load(std::memory_order_relaxed)},
+            std::chrono::nanoseconds{
+                MaxNanos().load(std::memory_order_relaxed)}};
+  }
+
+ protected:
+  static void Record(std::chrono::steady_clock::duration duration) {
+    const auto nanos =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+
+    Count().fetch_add(1, std::memory_order_relaxed);
+    TotalNanos().fetch_add(nanos, std::memory_order_relaxed);
+
+    auto max = MaxNanos().load(std::memory_order_relaxed);
+    while (nanos > max && !MaxNanos().compare_exchange_weak(
+                              max, nanos, std::memory_order_relaxed)) {
+    }
+  }
+
+ private:
+  static std::atomic<std::size_t>& Count() {
+    static std::atomic<std::size_t> ret_val{0};
+    return ret_val;
+  }
+
+  static std::atomic<std::chrono::nanoseconds::rep>& TotalNanos() {
+    static std::atomic<std::chrono::nanoseconds::rep> ret_val{0};
+    return ret_val;
+  }
+
+  static std::atomic<std::chrono::nanoseconds::rep>& MaxNanos() {
+    static std::atomic<std::chrono::nanoseconds::rep> ret_val{0};
+    return ret_val;
+  }
+};
+
+// A zero-copy view of a primitive array, backed by
+// `GetPrimitiveArrayCritical`. The VM will pin the array where it can, but in
+// exchange no other JNI call may be made (and the thread must not block) until
+// the view is destroyed. Keep the scope of these views tight:
+//
+//   {
+//     CriticalArrayView<jint> view = arr.PinCritical();
+//     std::copy(view.begin(), view.end(), dst);
+//   }
+//
+// In debug builds, JNI calls made while a view is open are counted (see
+// `JniEnv::CallsInCriticalRegion`), and regions are timed (see
+// `CriticalRegionStats`).
+//
+// If the VM can't provide the elements, `ptr()` is null, `size()` is 0, no
+// region is opened and an `OutOfMemoryError` is pending.
+template <typename SpanType>
+class CriticalArrayView : public CriticalArrayViewBase {
+ public:
+  CriticalArrayView(CriticalArrayView&&) = delete;
+  CriticalArrayView(const CriticalArrayView&) = delete;
+
+  CriticalArrayView(jarray array, bool copy_on_completion, std::size_t size)
+      : array_(array),
+        copy_on_completion_(copy_on_completion),
+        size_(size),
+        ptr_(static_cast<SpanType*>(
+            JniArrayHelperBase::GetPrimitiveArrayCritical(array))) {}
+
+  ~CriticalArrayView() {
+    JniArrayHelperBase::ReleasePrimitiveArrayCritical(array_, ptr_,
+                                                      copy_on_completion_);
+#ifndef NDEBUG
+    if (ptr_ != nullptr) {
+      Record(std::chrono::steady_clock::now() - start_);
+    }
+#endif  // NDEBUG
+  }
+
+  SpanType* ptr() const { return ptr_; }
+  SpanType* data() const { return ptr_; }
+  std::size_t size() const { return ptr_ ? size_ : 0; }
+
+  SpanType* begin() const { return ptr_; }
+  SpanType* end() const { return ptr_ + size(); }
+
+ private:
+  const jarray array_;
+  const bool copy_on_completion_;
+  const std::size_t size_;
+#ifndef NDEBUG
+  // Taken before `ptr_` is pinned.
+  const std::chrono::steady_clock::time_point start_ =
+      std::chrono::steady_clock::now();
+#endif  // NDEBUG
+  SpanType* const ptr_;
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_CRITICAL_ARRAY_VIEW_H_
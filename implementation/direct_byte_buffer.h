@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_DIRECT_BYTE_BUFFER_H_
+#define JNI_BIND_IMPLEMENTATION_DIRECT_BYTE_BUFFER_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <cstddef>
+#include <string_view>
+
+#include "class_defs/java_nio_classes.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/local_object.h"
+#include "implementation/promotion_mechanics_tags.h"
+#include "implementation/ref_base.h"
+#include "jni_dep.h"
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif  // __cplusplus >= 202002L
+
+namespace jni {
+
+// A local `java.nio.ByteBuffer` over native memory.
+//
+// Unlike arrays, the bytes of a direct buffer are never copied when crossing
+// to or from Java: the buffer *is* the native memory. It can be passed to any
+// method taking a `kJavaNioByteBuffer`, and built from one that is returned:
+//
+//   std::vector<std::byte> pixels = ...;
+//   DirectByteBuffer buffer{pixels.data(), pixels.size()};
+//   obj.Call<"decode">(buffer);
+//
+//   DirectByteBuffer result = obj.Call<"encoded">();
+//   Consume(result.data(), result.size());
+//
+// Wrapped memory is not owned and must outlive every use of the buffer on
+// either side.
+class DirectByteBuffer : public LocalObject<kJavaNioByteBuffer> {
+ public:
+  using Base = LocalObject<kJavaNioByteBuffer>;
+
+  DirectByteBuffer(AdoptLocal, jobject buffer) : Base(AdoptLocal{}, buffer) {}
+  DirectByteBuffer(NewRef, jobject buffer) : Base(NewRef{}, buffer) {}
+
+  template <const auto& class_v, const auto& class_loader_v, const auto& jvm_v>
+  DirectByteBuffer(LocalObject<class_v, class_loader_v, jvm_v>&& obj)
+      : Base(AdoptLocal{}, obj.Release()) {
+    static_assert(std::string_view{class_v.name_} ==
+                      std::string_view{kJavaNioByteBuffer.name_},
+                  "JNI Error: Only a java.nio.ByteBuffer can be adopted.");
+  }
+
+  // Wraps `size` bytes at `data`.
+  DirectByteBuffer(void* data, std::size_t size)
+      : Base(AdoptLocal{}, JniHelper::NewDirectByteBuffer(
+                               data, static_cast<jlong>(size))) {}
+
+  // Returns the native memory, or null if the buffer is not direct.
+  std::byte* data() const {
+    return static_cast<std::byte*>(
+        JniHelper::GetDirectBufferAddress(RefBase<jobject>::object_ref_));
+  }
+
+  // Returns the capacity in bytes, or 0 if the buffer is not direct.
+  std::size_t size() const {
+    jlong capacity =
+        JniHelper::GetDirectBufferCapacity(RefBase<jobject>::object_ref_);
+
+    return capacity < 0 ? 0 : static_cast<std::size_t>(capacity);
+  }
+
+#if __cplusplus >= 202002L
+  explicit DirectByteBuffer(std::span<std::byte> bytes)
+      : DirectByteBuffer(bytes.data(), bytes.size()) {}
+
+  // Empty if the buffer is not direct.
+  std::span<std::byte> AsSpan() const {
+    std::byte* ptr = data();
+
+    return ptr ? std::span<std::byte>{ptr, size()} : std::span<std::byte>{};
+  }
+
+  operator std::span<std::byte>() const { return AsSpan(); }
+#endif  // __cplusplus >= 202002L
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_DIRECT_BYTE_BUFFER_H_
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <cstddef>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif  // __cplusplus >= 202002L
+
+namespace {
+
+using ::jni::AdoptLocal;
+using ::jni::Class;
+using ::jni::DirectByteBuffer;
+using ::jni::Fake;
+using ::jni::kJavaNioByteBuffer;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::Return;
+
+static constexpr Class kImageCodec{
+    "com/google/ImageCodec",
+    Method{"decode", jni::Return<void>{}, Params{kJavaNioByteBuffer}},
+    Method{"encoded", jni::Return{kJavaNioByteBuffer}}};
+
+TEST_F(JniTest, DirectByteBuffer_WrapsNativeMemoryWithoutCopying) {
+  std::array<std::byte, 16> bytes{};
+  EXPECT_CALL(*env_, NewDirectByteBuffer(bytes.data(), 16))
+      .WillOnce(Return(Fake<jobject>()));
+  EXPECT_CALL(*env_, GetDirectBufferAddress(Fake<jobject>()))
+      .WillOnce(Return(bytes.data()));
+  EXPECT_CALL(*env_, GetDirectBufferCapacity(Fake<jobject>()))
+      .WillOnce(Return(16));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>()));
+
+  DirectByteBuffer buffer{bytes.data(), bytes.size()};
+
+  EXPECT_EQ(buffer.data(), bytes.data());
+  EXPECT_EQ(buffer.size(), 16);
+}
+
+TEST_F(JniTest, DirectByteBuffer_NonDirectBuffersAreEmpty) {
+  EXPECT_CALL(*env_, GetDirectBufferAddress).WillRepeatedly(Return(nullptr));
+  EXPECT_CALL(*env_, GetDirectBufferCapacity).WillRepeatedly(Return(-1));
+
+  DirectByteBuffer buffer{AdoptLocal{}, Fake<jobject>()};
+
+  EXPECT_EQ(buffer.data(), nullptr);
+  EXPECT_EQ(buffer.size(), 0);
+}
+
+TEST_F(JniTest, DirectByteBuffer_IsPassedAndReturnedThroughMethods) {
+  std::array<std::byte, 4> bytes{};
+  EXPECT_CALL(*env_, NewDirectByteBuffer).WillOnce(Return(Fake<jobject>(1)));
+  EXPECT_CALL(*env_, CallVoidMethodV(Fake<jobject>(), _, _));
+  EXPECT_CALL(*env_, CallObjectMethodV(Fake<jobject>(), _, _))
+      .WillOnce(Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, GetDirectBufferAddress(Fake<jobject>(2)))
+      .WillOnce(Return(bytes.data()));
+
+  LocalObject<kImageCodec> codec{AdoptLocal{}, Fake<jobject>()};
+  DirectByteBuffer buffer{bytes.data(), bytes.size()};
+  codec.Call<"decode">(buffer);
+
+  DirectByteBuffer encoded = codec.Call<"encoded">();
+  EXPECT_EQ(encoded.data(), bytes.data());
+}
+
+#if __cplusplus >= 202002L
+TEST_F(JniTest, DirectByteBuffer_ConvertsToAndFromSpans) {
+  std::array<std::byte, 8> bytes{};
+  EXPECT_CALL(*env_, NewDirectByteBuffer(bytes.data(), 8))
+      .WillOnce(Return(Fake<jobject>()));
+  EXPECT_CALL(*env_, GetDirectBufferAddress).WillOnce(Return(bytes.data()));
+  EXPECT_CALL(*env_, GetDirectBufferCapacity).WillOnce(Return(8));
+
+  DirectByteBuffer buffer{std::span<std::byte>{bytes}};
+  std::span<std::byte> span = buffer;
+
+  EXPECT_EQ(span.data(), bytes.data());
+  EXPECT_EQ(span.size(), 8);
+}
+#endif  // __cplusplus >= 202002L
+
+}  // namespace
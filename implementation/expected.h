@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_IMPLEMENTATION_EXPECTED_H_
+#define JNI_BIND_IMPLEMENTATION_EXPECTED_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace jni {
+
+// Wraps an error for construction of an `Expected`.
+template <typename E>
+struct Unexpected {
+  E error_;
+};
+
+template <typename E>
+Unexpected(E) -> Unexpected<E>;
+
+// Holds either a value of `T` or an error of `E`.  This is a subset of C++23's
+// `std::expected`, which is not yet available to all users of JNI Bind.  `T`
+// may be `void`.
+template <typename T, typename E>
+class Expected {
+ public:
+  using ValueT = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+  template <typename U = T, std::enable_if_t<std::is_void_v<U>, int> = 0>
+  Expected() : storage_(std::in_place_index<0>) {}
+
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  Expected(ValueT&& val) : storage_(std::in_place_index<0>, std::move(val)) {}
+
+  Expected(Unexpected<E>&& unexpected)
+      : storage_(std::in_place_index<1>, std::move(unexpected.error_)) {}
+
+  bool has_value() const { return storage_.index() == 0; }
+  explicit operator bool() const { return has_value(); }
+
+  // It is undefined behaviour to access the value of an error.
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  U& value() & {
+    return *std::get_if<0>(&storage_);
+  }
+
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  U&& value() && {
+    return std::move(*std::get_if<0>(&storage_));
+  }
+
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  U& operator*() & {
+    return value();
+  }
+
+  template <typename U = T, std::enable_if_t<!std::is_void_v<U>, int> = 0>
+  U* operator->() {
+    return &value();
+  }
+
+  // It is undefined behaviour to access the error of a value.
+  E& error() & { return *std::get_if<1>(&storage_); }
+  E&& error() && { return std::move(*std::get_if<1>(&storage_)); }
+
+ private:
+  std::variant<ValueT, E> storage_;
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_EXPECTED_H_
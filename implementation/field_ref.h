@@ -19,15 +19,19 @@
 
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <string_view>
 #include <type_traits>
 #include <utility>
-#include <vector>
 
+#include "implementation/class_ref.h"
 #include "implementation/configuration.h"
 #include "implementation/default_class_loader.h"
 #include "implementation/field_selection.h"
 #include "implementation/id.h"
+#include "implementation/id_table.h"
 #include "implementation/id_type.h"
 #include "implementation/jni_helper/field_value.h"
 #include "implementation/jni_helper/jni_helper.h"
@@ -36,18 +40,27 @@
 #include "implementation/proxy_convenience_aliases.h"
 #include "implementation/proxy_temporary.h"
 #include "implementation/ref_base.h"
+#include "implementation/ref_storage.h"
 #include "implementation/signature.h"
+#include "implementation/startup_profile.h"
 #include "jni_dep.h"
 #include "metaprogramming/double_locked_value.h"
+#include "metaprogramming/string_concatenate.h"
 
 namespace jni {
 
-// See JvmRef::~JvmRef.
-static inline auto& GetDefaultLoadedFieldList() {
-  static auto* ret_val =
-      new std::vector<metaprogramming::DoubleLockedValue<jfieldID>*>{};
-  return *ret_val;
-}
+// Fully qualified ID of a field, see `OverloadRefUniqueId`.
+template <typename IdT>
+struct FieldRefUniqueId {
+  static constexpr std::string_view kDash = "#";
+  static constexpr std::string_view kClassQualifier{IdT::Class().name_};
+  static constexpr std::string_view kFieldName{IdT::Name()};
+
+  static constexpr std::string_view TypeName() {
+    return metaprogramming::StringConcatenate_v<
+        kClassQualifier, kDash, kFieldName, kDash, Signature_v<IdT>>;
+  }
+};
 
 // Represents a live instance of Field I's definition.
 //
@@ -68,25 +81,59 @@ class FieldRef {
   FieldRef(const FieldRef&&) = delete;
   void operator=(const FieldRef&) = delete;
 
+  // Key and entry for `StartupProfile` (default class loader only).
+  static constexpr std::string_view kProfileKey =
+      FieldRefUniqueId<IdT>::TypeName();
+
+  static StartupProfileEntry ProfileEntry() {
+    return {IdT::Class().name_, IdT::Name(), Signature_v<IdT>.data(),
+            +[]() {
+              return ClassRef_t<JniT>::GetAndMaybeLoadClassRef(nullptr);
+            },
+            +[](jclass clazz) { return GetFieldID(clazz) != nullptr; }};
+  }
+
   // This method is thread safe.
   static jfieldID GetFieldID(jclass clazz) {
-    static jni::metaprogramming::DoubleLockedValue<jfieldID> return_value;
-
-    return return_value.LoadAndMaybeInit([=]() {
-      if constexpr (JniT::class_loader_v == kDefaultClassLoader) {
-        if (kConfiguration.release_field_ids_on_teardown_) {
-          GetDefaultLoadedFieldList().push_back(&return_value);
-        }
-      }
+    // Field IDs are only invalidated on teardown if
+    // `kConfiguration.release_field_ids_on_teardown_` is set, in which case
+    // the generation is bumped (see JvmRef::~JvmRef).
+    if constexpr (JniT::class_loader_v == kDefaultClassLoader) {
+      static_cast<void>(StartupProfileRegistration<FieldRef>::kRegistered);
+    }
+    const std::uint32_t generation =
+        IdGeneration<jfieldID>().load(std::memory_order_relaxed);
 
+    auto get_lambda = [=]() {
+      jfieldID field;
       if constexpr (IdT::kIsStatic) {
-        return jni::JniHelper::GetStaticFieldID(clazz, IdT::Name(),
-                                                Signature_v<IdT>.data());
+        field = jni::JniHelper::GetStaticFieldID(clazz, IdT::Name(),
+                                                 Signature_v<IdT>.data());
       } else {
-        return jni::JniHelper::GetFieldID(clazz, IdT::Name(),
-                                          Signature_v<IdT>.data());
+        field = jni::JniHelper::GetFieldID(clazz, IdT::Name(),
+                                           Signature_v<IdT>.data());
+      }
+
+      if (JniT::class_loader_v == kDefaultClassLoader && field != nullptr) {
+        StartupProfile::MaybeRecord(kProfileKey);
       }
-    });
+
+      return field;
+    };
+
+    // Stored in the class's dense `IdTable`, which for non-default loaders is
+    // per loaded `jclass` (see `ClassRef`).
+    using IdTableT = IdTable<typename JniT::MinimallySpanningType>;
+    if constexpr (JniT::class_loader_v == kDefaultClassLoader) {
+      return IdTableT::template FieldId<IdT>().LoadAndMaybeInit(get_lambda,
+                                                                generation);
+    } else {
+      metaprogramming::DoubleLockedValue<jfieldID>* storage =
+          IdTableT::template FieldId<IdT>(clazz);
+
+      return storage ? storage->LoadAndMaybeInit(get_lambda, generation)
+                     : get_lambda();
+    }
   }
 
   using ReturnProxied =
@@ -102,28 +149,40 @@ class FieldRef {
     }
   }
 
-  ReturnProxied Get() {
+  // The receiver of the field access, the jclass for statics.
+  using SelfT = std::conditional_t<IdT::kIsStatic, jclass, jobject>;
+
+  // Reads the field from `self_val` using an already resolved `field_id`
+  // (see `BoundField`).
+  static ReturnProxied GetWithFieldID(SelfT self_val, jfieldID field_id) {
+    using Helper = FieldHelper<CDecl_t<typename IdT::RawValT>, IdT::kRank,
+                               IdT::kIsStatic>;
+
     if constexpr (std::is_base_of_v<RefBaseBase, ReturnProxied>) {
-      return {AdoptLocal{},
-              FieldHelper<CDecl_t<typename IdT::RawValT>, IdT::kRank,
-                          IdT::kIsStatic>::GetValue(SelfVal(),
-                                                    GetFieldID(class_ref_))};
+      return {AdoptLocal{}, Helper::GetValue(self_val, field_id)};
     } else {
-      return {FieldHelper<CDecl_t<typename IdT::RawValT>, IdT::kRank,
-                          IdT::kIsStatic>::GetValue(SelfVal(),
-                                                    GetFieldID(class_ref_))};
+      return {Helper::GetValue(self_val, field_id)};
     }
   }
 
   template <typename T>
-  void Set(T&& value) {
+  static void SetWithFieldID(SelfT self_val, jfieldID field_id, T&& value) {
     FieldHelper<CDecl_t<typename IdT::RawValT>, IdT::kRank,
-                IdT::kIsStatic>::SetValue(SelfVal(), GetFieldID(class_ref_),
+                IdT::kIsStatic>::SetValue(self_val, field_id,
                                           ForwardWithProxyTemporaryStrip(
                                               Proxy_t<T>::ProxyAsArg(
                                                   std::forward<T>(value))));
   }
 
+  ReturnProxied Get() {
+    return GetWithFieldID(SelfVal(), GetFieldID(class_ref_));
+  }
+
+  template <typename T>
+  void Set(T&& value) {
+    SetWithFieldID(SelfVal(), GetFieldID(class_ref_), std::forward<T>(value));
+  }
+
  private:
   const jclass class_ref_;
   const jobject object_ref_;
@@ -19,9 +19,14 @@
 
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
+#include <cstdint>
+
 #include "implementation/default_class_loader.h"
+#include "implementation/find_class_fallback_cache.h"
 #include "implementation/global_class_loader.h"
 #include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_helper/lifecycle.h"
+#include "implementation/jni_helper/lifecycle_object.h"
 #include "implementation/local_object.h"
 #include "implementation/promotion_mechanics_tags.h"
 #include "jni_dep.h"
@@ -33,7 +38,23 @@ namespace jni {
 // be rewritten in porcelain JNI, but this flow ought to be only on
 // secondary threads with previously unused `jclass`'s (which is mostly rare),
 // and this is simpler to reason about than porcelain JNI.
+//
+// Outcomes are cached by name (see `FindClassFallbackCache`), so only the first
+// attempt for a given class goes through the loader. The returned `jclass` is
+// always a local (or null if the class could not be loaded).
 inline jclass FindClassFallback(const char* class_name) {
+  jclass cached_class;
+  if (FindClassFallbackCache::Find(class_name, cached_class)) {
+    return cached_class == nullptr
+               ? nullptr
+               : LifecycleHelper<jclass, LifecycleType::LOCAL>::NewReference(
+                     cached_class);
+  }
+
+  // Read before the loader, which is replaced before the cache is cleared (see
+  // `JvmRef::SetFallbackClassLoader`).
+  const std::uint64_t generation = FindClassFallbackCache::Generation();
+
   // The loader will be primed by the JVM, however, it needs to be accessible
   // from the jni_helper layer. See `JvmRef` for how this is primed.
   GlobalClassLoader<kDefaultClassLoader> loader{AdoptGlobal{},
@@ -52,6 +73,20 @@ inline jclass FindClassFallback(const char* class_name) {
 
   loader.Release();
 
+  if (ret == nullptr) {
+    // Subsequent lookups are answered by the tombstone, so the
+    // `ClassNotFoundException` is cleared here for consistent behaviour.
+    JniHelper::ExceptionClear();
+    FindClassFallbackCache::Insert(class_name, nullptr, generation);
+
+    return nullptr;
+  }
+
+  FindClassFallbackCache::Insert(
+      class_name,
+      LifecycleHelper<jclass, LifecycleType::GLOBAL>::NewReference(ret),
+      generation);
+
   return ret;
 }
 
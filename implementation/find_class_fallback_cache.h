@@ -0,0 +1,191 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_FIND_CLASS_FALLBACK_CACHE_H_
+#define JNI_BIND_IMPLEMENTATION_FIND_CLASS_FALLBACK_CACHE_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "implementation/jni_helper/lifecycle.h"
+#include "implementation/jni_helper/lifecycle_object.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Counters for `FindClassFallbackCache`.
+struct FindClassFallbackStats {
+  // Lookups answered with a previously loaded class.
+  std::size_t hits;
+
+  // Lookups answered with a previously failed load (a "tombstone").
+  std::size_t negative_hits;
+
+  // Lookups that were not cached and went to the fallback loader.
+  std::size_t misses;
+};
+
+// Caches the outcome of `FindClassFallback` by class name. A successful load
+// is held as a global `jclass`, a failed load as null, so either costs one
+// hash probe after the first attempt.
+//
+// Entries are released by `JvmRef` on teardown (if class IDs are released)
+// and whenever the fallback loader is replaced. Failures are otherwise
+// permanent, so if classes may become loadable later (e.g. once a dynamically
+// delivered module is installed), call `ClearTombstones` when they do.
+//
+// Lookups that are in flight when the cache is cleared must not repopulate it
+// with outcomes from before the clear, so each load is stamped with the
+// `Generation` it started in and its `Insert` is dropped if that has changed.
+//
+// This class is thread-safe.
+class FindClassFallbackCache {
+ public:
+  // Returns true if `name` has been loaded (or failed to load) before, in which
+  // case `clazz` is set to the cached global (or null).
+  static bool Find(const char* name, jclass& clazz) {
+    {
+      std::shared_lock lock{Mutex()};
+      auto it = Entries().find(std::string_view{name});
+
+      if (it != Entries().end()) {
+        clazz = it->second;
+        (clazz ? Hits() : NegativeHits())
+            .fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+
+    Misses().fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  // The current generation, read before starting a load to pass to `Insert`.
+  static std::uint64_t Generation() {
+    std::shared_lock lock{Mutex()};
+    return generation_;
+  }
+
+  // Records the outcome of loading `name`, begun in `generation`. `clazz` must
+  // be a global or null, and is owned by the cache thereafter. If another
+  // thread raced to insert `name`, its entry is kept and returned, and `clazz`
+  // is released. If the cache has been cleared since `generation`, nothing is
+  // recorded, `clazz` is released and null is returned.
+  static jclass Insert(const char* name, jclass clazz,
+                       std::uint64_t generation) {
+    std::unique_lock lock{Mutex()};
+    if (generation != generation_) {
+      if (clazz != nullptr) {
+        LifecycleHelper<jclass, LifecycleType::GLOBAL>::Delete(clazz);
+      }
+
+      return nullptr;
+    }
+
+    auto [it, inserted] = Entries().try_emplace(std::string{name}, clazz);
+
+    if (!inserted && clazz != nullptr) {
+      LifecycleHelper<jclass, LifecycleType::GLOBAL>::Delete(clazz);
+    }
+
+    return it->second;
+  }
+
+  // Forgets every failed load, so each is retried on its next lookup. Loaded
+  // classes remain cached.
+  static void ClearTombstones() {
+    std::unique_lock lock{Mutex()};
+    ++generation_;
+
+    for (auto it = Entries().begin(); it != Entries().end();) {
+      it = it->second == nullptr ? Entries().erase(it) : std::next(it);
+    }
+  }
+
+  // Releases every cached global and forgets every tombstone.
+  static void Clear() {
+    std::unique_lock lock{Mutex()};
+    ++generation_;
+
+    for (auto& [name, clazz] : Entries()) {
+      if (clazz != nullptr) {
+        LifecycleHelper<jclass, LifecycleType::GLOBAL>::Delete(clazz);
+      }
+    }
+    Entries().clear();
+  }
+
+  static FindClassFallbackStats GetStats() {
+    return {Hits().load(std::memory_order_relaxed),
+            NegativeHits().load(std::memory_order_relaxed),
+            Misses().load(std::memory_order_relaxed)};
+  }
+
+ private:
+  // Permits lookup by `std::string_view` without constructing a key.
+  struct NameHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view name) const {
+      return std::hash<std::string_view>{}(name);
+    }
+  };
+
+  using Map =
+      std::unordered_map<std::string, jclass, NameHash, std::equal_to<>>;
+
+  static Map& Entries() {
+    static auto* ret_val = new Map{};
+    return *ret_val;
+  }
+
+  static std::shared_mutex& Mutex() {
+    static auto* ret_val = new std::shared_mutex{};
+    return *ret_val;
+  }
+
+  // Bumped by every clear, guarded by `Mutex()`.
+  static inline std::uint64_t generation_ = 0;
+
+  static std::atomic<std::size_t>& Hits() {
+    static std::atomic<std::size_t> ret_val{0};
+    return ret_val;
+  }
+
+  static std::atomic<std::size_t>& NegativeHits() {
+    static std::atomic<std::size_t> ret_val{0};
+    return ret_val;
+  }
+
+  static std::atomic<std::size_t>& Misses() {
+    static std::atomic<std::size_t> ret_val{0};
+    return ret_val;
+  }
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_FIND_CLASS_FALLBACK_CACHE_H_
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Fake;
+using ::jni::FallbackLoader;
+using ::jni::FindClassFallbackCache;
+using ::jni::FindClassFallbackStats;
+using ::jni::JniHelper;
+using ::jni::test::AsGlobal;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Return;
+using ::testing::StrEq;
+
+TEST_F(JniTest, FindClassFallbackCache_CachesLoadsAndTombstones) {
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>(1)))).Times(1);
+
+  FindClassFallbackStats before = FindClassFallbackCache::GetStats();
+
+  jclass clazz = Fake<jclass>(2);
+  EXPECT_FALSE(FindClassFallbackCache::Find("com/google/Loaded", clazz));
+  const std::uint64_t generation = FindClassFallbackCache::Generation();
+  EXPECT_EQ(FindClassFallbackCache::Insert(
+                "com/google/Loaded", AsGlobal(Fake<jclass>(1)), generation),
+            AsGlobal(Fake<jclass>(1)));
+  EXPECT_EQ(
+      FindClassFallbackCache::Insert("com/google/Missing", nullptr, generation),
+      nullptr);
+
+  EXPECT_TRUE(FindClassFallbackCache::Find("com/google/Loaded", clazz));
+  EXPECT_EQ(clazz, AsGlobal(Fake<jclass>(1)));
+  EXPECT_TRUE(FindClassFallbackCache::Find("com/google/Missing", clazz));
+  EXPECT_EQ(clazz, nullptr);
+
+  FindClassFallbackStats after = FindClassFallbackCache::GetStats();
+  EXPECT_EQ(after.hits - before.hits, 1);
+  EXPECT_EQ(after.negative_hits - before.negative_hits, 1);
+  EXPECT_EQ(after.misses - before.misses, 1);
+
+  FindClassFallbackCache::Clear();
+  EXPECT_FALSE(FindClassFallbackCache::Find("com/google/Loaded", clazz));
+}
+
+TEST_F(JniTest, FindClassFallbackCache_FailedFallbackIsOnlyAttemptedOnce) {
+  EXPECT_CALL(*env_, FindClass).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(StrEq("com/google/Missing")))
+      .Times(2)
+      .WillRepeatedly(Return(nullptr));
+  EXPECT_CALL(*env_, CallObjectMethodV(_, _, _))
+      .Times(1)
+      .WillOnce(Return(nullptr));
+
+  FallbackLoader() = Fake<jobject>(1);
+
+  EXPECT_EQ(JniHelper::FindClass("com/google/Missing"), nullptr);
+  EXPECT_EQ(JniHelper::FindClass("com/google/Missing"), nullptr);
+
+  FallbackLoader() = nullptr;
+  FindClassFallbackCache::Clear();
+}
+
+TEST_F(JniTest, FindClassFallbackCache_ClearTombstonesRetriesOnlyFailures) {
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>(1)))).Times(1);
+
+  const std::uint64_t generation = FindClassFallbackCache::Generation();
+  FindClassFallbackCache::Insert("com/google/Loaded", AsGlobal(Fake<jclass>(1)),
+                                 generation);
+  FindClassFallbackCache::Insert("com/google/Missing", nullptr, generation);
+
+  FindClassFallbackCache::ClearTombstones();
+
+  jclass clazz = nullptr;
+  EXPECT_TRUE(FindClassFallbackCache::Find("com/google/Loaded", clazz));
+  EXPECT_EQ(clazz, AsGlobal(Fake<jclass>(1)));
+  EXPECT_FALSE(FindClassFallbackCache::Find("com/google/Missing", clazz));
+
+  FindClassFallbackCache::Clear();
+}
+
+TEST_F(JniTest, FindClassFallbackCache_DropsInsertsFromBeforeAClear) {
+  EXPECT_CALL(*env_, DeleteGlobalRef(AsGlobal(Fake<jclass>(1)))).Times(1);
+
+  // e.g. lookups that started against a fallback loader since replaced.
+  const std::uint64_t generation = FindClassFallbackCache::Generation();
+  FindClassFallbackCache::Clear();
+
+  EXPECT_EQ(FindClassFallbackCache::Insert(
+                "com/google/Stale", AsGlobal(Fake<jclass>(1)), generation),
+            nullptr);
+  EXPECT_EQ(
+      FindClassFallbackCache::Insert("com/google/Missing", nullptr, generation),
+      nullptr);
+
+  jclass clazz = nullptr;
+  EXPECT_FALSE(FindClassFallbackCache::Find("com/google/Stale", clazz));
+  EXPECT_FALSE(FindClassFallbackCache::Find("com/google/Missing", clazz));
+}
+
+TEST_F(JniTest, FindClassFallbackCache_FailedFallbackIsRetriedAfterClear) {
+  EXPECT_CALL(*env_, FindClass).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(StrEq("com/google/Late")))
+      .Times(2)
+      .WillRepeatedly(Return(nullptr));
+  EXPECT_CALL(*env_, CallObjectMethodV(_, _, _))
+      .WillOnce(Return(nullptr))
+      .WillOnce(Return(Fake<jobject>(2)));
+
+  FallbackLoader() = Fake<jobject>(1);
+
+  EXPECT_EQ(JniHelper::FindClass("com/google/Late"), nullptr);
+  FindClassFallbackCache::ClearTombstones();
+  EXPECT_NE(JniHelper::FindClass("com/google/Late"), nullptr);
+
+  FallbackLoader() = nullptr;
+  FindClassFallbackCache::Clear();
+}
+
+}  // namespace
@@ -75,6 +75,9 @@ class GlobalException;
 class LocalString;
 class GlobalString;
 
+// Direct buffers.
+class DirectByteBuffer;
+
 // Arrays.
 template <typename SpanType, std::size_t kRank_, const auto& class_v_,
           const auto& class_loader_v_, const auto& jvm_v_>
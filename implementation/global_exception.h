@@ -24,7 +24,7 @@
 #include "implementation/default_class_loader.h"
 #include "implementation/forward_declarations.h"
 #include "implementation/global_object.h"
-#include "implementation/jni_helper/jni_env.h"
+#include "implementation/jni_helper/jni_helper.h"
 #include "implementation/jni_helper/lifecycle.h"
 #include "implementation/jni_helper/lifecycle_object.h"
 #include "implementation/jni_type.h"
@@ -71,11 +71,10 @@ class GlobalException
     return *this;
   }
 
+  // Throws this exception object itself, so its type, message, cause and
+  // stack trace are preserved.
   void Throw() {
-    LocalString message = (*this)("getMessage");
-    ::jni::JniEnv::GetEnv()->ThrowNew(
-        ::jni::ClassRef<JniT>::GetAndMaybeLoadClassRef(nullptr),
-        message.PinAsStr().ToString().c_str());
+    JniHelper::Throw(static_cast<jthrowable>(RefBase<jobject>::object_ref_));
   }
 };
 
@@ -19,6 +19,8 @@
 
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
+#include <string>
+
 #include "class_defs/java_lang_classes.h"
 #include "implementation/default_class_loader.h"
 #include "implementation/global_object.h"
@@ -64,6 +66,11 @@ class GlobalString : public GlobalStringImpl {
   // Returns a UtfString which performs an expensive copy to std::string
   // and releases the pinned characters.
   UtfString PinAsStr() { return UtfString{RefBase<jstring>::object_ref_}; }
+
+  // Returns a copy of the contents as an std::string (see `CopyToStdString`).
+  std::string AsStdString() const {
+    return CopyToStdString(RefBase<jstring>::object_ref_);
+  }
 };
 
 }  // namespace jni
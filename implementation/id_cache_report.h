@@ -0,0 +1,57 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_ID_CACHE_REPORT_H_
+#define JNI_BIND_IMPLEMENTATION_ID_CACHE_REPORT_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <atomic>
+#include <cstddef>
+
+#include "implementation/id_table.h"
+#include "jni_dep.h"
+#include "metaprogramming/double_locked_value.h"
+
+namespace jni {
+
+// A snapshot of the jclass, jmethodID and jfieldID caches that currently hold
+// a resolved ID. IDs invalidated on teardown (see `JvmRef`) are not counted.
+struct IdCacheReport {
+  std::size_t class_ids;
+  std::size_t method_ids;
+  std::size_t field_ids;
+
+  // Bytes of cache storage: every `IdTable`, which has a slot for each declared
+  // member whether resolved or not, plus each resolved jclass.
+  std::size_t bytes;
+};
+
+inline IdCacheReport GetIdCacheReport() {
+  using metaprogramming::DoubleLockedValue;
+
+  IdCacheReport report{DoubleLockedValue<jclass>::LiveCount(),
+                       DoubleLockedValue<jmethodID>::LiveCount(),
+                       DoubleLockedValue<jfieldID>::LiveCount(), 0};
+  report.bytes = IdTableBytes().load(std::memory_order_relaxed) +
+                 report.class_ids * sizeof(DoubleLockedValue<jclass>);
+
+  return report;
+}
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_ID_CACHE_REPORT_H_
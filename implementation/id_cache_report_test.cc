@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::Fake;
+using ::jni::Field;
+using ::jni::GetIdCacheReport;
+using ::jni::IdCacheReport;
+using ::jni::IdTable;
+using ::jni::JniT;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::metaprogramming::DoubleLockedValue;
+using ::jni::test::JniTest;
+
+static constexpr Class kClass{
+    "kClass",
+    Method{"Foo", Return<jint>{}, Params<>{}},
+    Method{"Bar", Return<void>{}, Params<>{}},
+    Field{"field", jint{}},
+};
+
+using IdTableT = IdTable<JniT<jobject, kClass>::MinimallySpanningType>;
+
+TEST_F(JniTest, IdCacheReport_CountsResolvedIds) {
+  IdCacheReport before = GetIdCacheReport();
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  obj.Call<"Foo">();
+  obj.Call<"Foo">();
+  obj.Call<"Bar">();
+  obj.Access<"field">().Get();
+
+  IdCacheReport after = GetIdCacheReport();
+  EXPECT_EQ(after.class_ids - before.class_ids, 1);
+  EXPECT_EQ(after.method_ids - before.method_ids, 2);
+  EXPECT_EQ(after.field_ids - before.field_ids, 1);
+  // Method and field slots were allocated up front, only the jclass is new.
+  EXPECT_EQ(after.bytes - before.bytes, sizeof(DoubleLockedValue<jclass>));
+  EXPECT_GE(after.bytes, IdTableT::kNumMethodIds *
+                                 sizeof(DoubleLockedValue<jmethodID>) +
+                             IdTableT::kNumFieldIds *
+                                 sizeof(DoubleLockedValue<jfieldID>));
+}
+
+TEST_F(JniTest, IdCacheReport_TeardownDropsInvalidatedIds) {
+  LocalObject<kClass> obj{Fake<jobject>()};
+  obj.Call<"Foo">();
+  obj.Access<"field">().Get();
+
+  IdCacheReport before = GetIdCacheReport();
+  ASSERT_GT(before.method_ids, 0);
+  ASSERT_GT(before.field_ids, 0);
+
+  default_globals_made_that_should_be_released_.clear();
+  default_jvm_ref_.reset();
+
+  // Tables remain allocated, but nothing in them is current.
+  IdCacheReport after = GetIdCacheReport();
+  EXPECT_EQ(after.method_ids, 0);
+  EXPECT_EQ(after.field_ids, 0);
+  EXPECT_EQ(before.bytes - after.bytes,
+            (before.class_ids - after.class_ids) *
+                sizeof(DoubleLockedValue<jclass>));
+
+  // IDs re-resolved against a new JvmRef are counted again.
+  default_jvm_ref_ = std::make_unique<jni::JvmRef<jni::kDefaultJvm>>(
+      jvm_.get(), jni::test::kDefaultConfiguration);
+  obj.Call<"Foo">();
+  EXPECT_EQ(GetIdCacheReport().method_ids, 1);
+}
+
+}  // namespace
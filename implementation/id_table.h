@@ -0,0 +1,183 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_ID_TABLE_H_
+#define JNI_BIND_IMPLEMENTATION_ID_TABLE_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/class_keyed_map.h"
+#include "implementation/id_type.h"
+#include "implementation/no_idx.h"
+#include "jni_dep.h"
+#include "metaprogramming/double_locked_value.h"
+
+namespace jni {
+
+// Sums the number of overloads in the first `sizeof...(Is)` overload sets.
+template <typename OverloadSetsT, std::size_t... Is>
+constexpr std::size_t NumOverloads(std::index_sequence<Is...>) {
+  return (std::size_t{0} + ... +
+          std::tuple_size_v<std::decay_t<decltype(
+              std::tuple_element_t<Is, OverloadSetsT>::invocations_)>>);
+}
+
+// Bytes of every `IdTable` in the binary, see `GetIdCacheReport`.
+inline std::atomic<std::size_t>& IdTableBytes() {
+  static std::atomic<std::size_t> ret_val{0};
+  return ret_val;
+}
+
+// Dense storage for every `jmethodID` and `jfieldID` of a class.
+//
+// Each ID is given a compile-time slot in definition order: constructors, then
+// every overload of each method, then every overload of each static method for
+// `jmethodID`, and fields then static fields for `jfieldID`. Repeated calls to
+// different members of the same class therefore touch neighbouring memory
+// rather than unrelated statics.
+//
+// Tables are keyed by the same minimal `JniT` as `ClassRef_t`, i.e. one per
+// class per loader, alongside the class's `jclass`. Only IDs declared directly
+// on the class (ancestry 0) have a slot.
+//
+// A class of a non-default loader may be loaded by several instances of that
+// loader, so it has a table per `jclass` instead (see `ClassKeyedMap`).
+template <typename JniT>
+struct IdTable {
+  using ConstructorsT =
+      std::decay_t<decltype(JniT::stripped_class_v.constructors_)>;
+  using MethodsT = std::decay_t<decltype(JniT::stripped_class_v.methods_)>;
+  using StaticMethodsT =
+      std::decay_t<decltype(JniT::stripped_class_v.static_.methods_)>;
+  using FieldsT = std::decay_t<decltype(JniT::stripped_class_v.fields_)>;
+  using StaticFieldsT =
+      std::decay_t<decltype(JniT::stripped_class_v.static_.fields_)>;
+
+  static constexpr std::size_t kNumConstructors =
+      std::tuple_size_v<ConstructorsT>;
+  static constexpr std::size_t kNumMethods = NumOverloads<MethodsT>(
+      std::make_index_sequence<std::tuple_size_v<MethodsT>>());
+  static constexpr std::size_t kNumStaticMethods = NumOverloads<StaticMethodsT>(
+      std::make_index_sequence<std::tuple_size_v<StaticMethodsT>>());
+  static constexpr std::size_t kNumMethodIds =
+      kNumConstructors + kNumMethods + kNumStaticMethods;
+
+  static constexpr std::size_t kNumFieldIds =
+      std::tuple_size_v<FieldsT> + std::tuple_size_v<StaticFieldsT>;
+
+  // Slot of an `OVERLOAD` or `STATIC_OVERLOAD` `IdT`, or `kNoIdx` if it has
+  // none (e.g. an inherited method).
+  template <typename IdT>
+  static constexpr std::size_t MethodSlot() {
+    if constexpr (IdT::kAncestorIdx != 0) {
+      return kNoIdx;
+    } else if constexpr (IdT::kIsConstructor) {
+      return IdT::kSecondaryIdx < kNumConstructors ? IdT::kSecondaryIdx
+                                                    : kNoIdx;
+    } else if constexpr (IdT::kIsStatic) {
+      return kNumConstructors + kNumMethods +
+             NumOverloads<StaticMethodsT>(
+                 std::make_index_sequence<IdT::kIdx>()) +
+             IdT::kSecondaryIdx;
+    } else {
+      return kNumConstructors +
+             NumOverloads<MethodsT>(std::make_index_sequence<IdT::kIdx>()) +
+             IdT::kSecondaryIdx;
+    }
+  }
+
+  // Slot of a `FIELD` or `STATIC_FIELD` `IdT`.
+  template <typename IdT>
+  static constexpr std::size_t FieldSlot() {
+    if constexpr (IdT::kIdType == IdType::STATIC_FIELD) {
+      return std::tuple_size_v<FieldsT> + IdT::kIdx;
+    } else {
+      return IdT::kIdx;
+    }
+  }
+
+  template <typename IdT>
+  static metaprogramming::DoubleLockedValue<jmethodID>& MethodId() {
+    static_assert(MethodSlot<IdT>() < kNumMethodIds);
+    static_cast<void>(kRegistered);
+    return storage_.method_ids[MethodSlot<IdT>()];
+  }
+
+  template <typename IdT>
+  static metaprogramming::DoubleLockedValue<jfieldID>& FieldId() {
+    static_assert(FieldSlot<IdT>() < kNumFieldIds);
+    static_cast<void>(kRegistered);
+    return storage_.field_ids[FieldSlot<IdT>()];
+  }
+
+  // As above, but for the table of `clazz`, a global `jclass` of this class
+  // from one loader instance. Returns null if there are more such `jclass`'s
+  // than tables, in which case the ID should not be cached.
+  template <typename IdT>
+  static metaprogramming::DoubleLockedValue<jmethodID>* MethodId(jclass clazz) {
+    static_assert(MethodSlot<IdT>() < kNumMethodIds);
+    static_cast<void>(kRegistered);
+    Storage* storage = class_keyed_storage_.FindOrInsert(clazz);
+    return storage ? &storage->method_ids[MethodSlot<IdT>()] : nullptr;
+  }
+
+  template <typename IdT>
+  static metaprogramming::DoubleLockedValue<jfieldID>* FieldId(jclass clazz) {
+    static_assert(FieldSlot<IdT>() < kNumFieldIds);
+    static_cast<void>(kRegistered);
+    Storage* storage = class_keyed_storage_.FindOrInsert(clazz);
+    return storage ? &storage->field_ids[FieldSlot<IdT>()] : nullptr;
+  }
+
+ private:
+  struct Storage {
+    std::array<metaprogramming::DoubleLockedValue<jmethodID>, kNumMethodIds>
+        method_ids;
+    std::array<metaprogramming::DoubleLockedValue<jfieldID>, kNumFieldIds>
+        field_ids;
+
+    void Reset() {
+      for (auto& method_id : method_ids) {
+        method_id.Reset();
+      }
+      for (auto& field_id : field_ids) {
+        field_id.Reset();
+      }
+    }
+  };
+
+  static inline Storage storage_;
+  static inline ClassKeyedMap<Storage> class_keyed_storage_;
+
+  // Every slot is allocated up front, so tables are counted towards
+  // `IdTableBytes` in full during static initialisation, resolved or not.
+  static inline const bool kRegistered = [] {
+    IdTableBytes().fetch_add(sizeof(storage_) + sizeof(class_keyed_storage_),
+                             std::memory_order_relaxed);
+    return true;
+  }();
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_ID_TABLE_H_
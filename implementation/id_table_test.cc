@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstddef>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::Constructor;
+using ::jni::Fake;
+using ::jni::Field;
+using ::jni::Id;
+using ::jni::IdTable;
+using ::jni::IdType;
+using ::jni::JniT;
+using ::jni::kNoIdx;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Overload;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::StaticRef;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::StrEq;
+
+static constexpr Class kClass{
+    "kClass",
+    Constructor{},
+    Constructor{jint{}},
+    Static{
+        Method{"StaticFoo", Return<jint>{}, Params<>{}},
+        Field{"staticField", jint{}},
+    },
+    Method{"Foo", Overload{Return<jint>{}, Params<>{}},
+           Overload{Return<jint>{}, Params<jint>{}}},
+    Method{"Bar", Return<void>{}, Params<>{}},
+    Field{"field1", jint{}},
+    Field{"field2", jint{}},
+};
+
+using JniTT = JniT<jobject, kClass>::MinimallySpanningType;
+using IdTableT = IdTable<JniTT>;
+
+template <IdType kIdType, std::size_t idx, std::size_t secondary_idx,
+          std::size_t ancestry_idx = 0>
+using IdT = Id<JniTT, kIdType, idx, secondary_idx, kNoIdx, ancestry_idx>;
+
+static_assert(IdTableT::kNumMethodIds == 6);
+static_assert(IdTableT::kNumFieldIds == 3);
+
+// Constructors, then method overloads, then static method overloads.
+static_assert(IdTableT::MethodSlot<IdT<IdType::OVERLOAD, kNoIdx, 0>>() == 0);
+static_assert(IdTableT::MethodSlot<IdT<IdType::OVERLOAD, kNoIdx, 1>>() == 1);
+static_assert(IdTableT::MethodSlot<IdT<IdType::OVERLOAD, 0, 0>>() == 2);
+static_assert(IdTableT::MethodSlot<IdT<IdType::OVERLOAD, 0, 1>>() == 3);
+static_assert(IdTableT::MethodSlot<IdT<IdType::OVERLOAD, 1, 0>>() == 4);
+static_assert(IdTableT::MethodSlot<IdT<IdType::STATIC_OVERLOAD, 0, 0>>() ==
+              5);
+
+// Fields, then static fields.
+static_assert(IdTableT::FieldSlot<IdT<IdType::FIELD, 0, kNoIdx>>() == 0);
+static_assert(IdTableT::FieldSlot<IdT<IdType::FIELD, 1, kNoIdx>>() == 1);
+static_assert(IdTableT::FieldSlot<IdT<IdType::STATIC_FIELD, 0, kNoIdx>>() ==
+              2);
+
+TEST_F(JniTest, IdTable_StoresEachIdInItsOwnSlot) {
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("()I")))
+      .WillOnce(testing::Return(Fake<jmethodID>(1)));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("(I)I")))
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Bar"), StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(3)));
+  EXPECT_CALL(*env_, GetStaticMethodID(_, StrEq("StaticFoo"), StrEq("()I")))
+      .WillOnce(testing::Return(Fake<jmethodID>(4)));
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("field1"), StrEq("I")))
+      .WillOnce(testing::Return(Fake<jfieldID>(1)));
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("field2"), StrEq("I")))
+      .WillOnce(testing::Return(Fake<jfieldID>(2)));
+  EXPECT_CALL(*env_, GetStaticFieldID(_, StrEq("staticField"), StrEq("I")))
+      .WillOnce(testing::Return(Fake<jfieldID>(3)));
+
+  for (int i = 0; i < 2; ++i) {
+    LocalObject<kClass> obj{Fake<jobject>()};
+    obj.Call<"Foo">();
+    obj.Call<"Foo">(1);
+    obj.Call<"Bar">();
+    obj.Access<"field1">().Get();
+    obj.Access<"field2">().Get();
+    StaticRef<kClass>{}.Call<"StaticFoo">();
+    StaticRef<kClass>{}.Access<"staticField">().Get();
+  }
+
+  // Cached values are read back without re-resolving them.
+  const auto method_generation = jni::IdGeneration<jmethodID>().load();
+  const auto field_generation = jni::IdGeneration<jfieldID>().load();
+  auto unexpected_method = []() { return jmethodID{0}; };
+  auto unexpected_field = []() { return jfieldID{0}; };
+
+  using FooId = IdT<IdType::OVERLOAD, 0, 0>;
+  using FooIntId = IdT<IdType::OVERLOAD, 0, 1>;
+  using StaticFieldId = IdT<IdType::STATIC_FIELD, 0, kNoIdx>;
+
+  EXPECT_EQ(IdTableT::MethodId<FooId>().LoadAndMaybeInit(unexpected_method,
+                                                         method_generation),
+            Fake<jmethodID>(1));
+  EXPECT_EQ(IdTableT::MethodId<FooIntId>().LoadAndMaybeInit(unexpected_method,
+                                                            method_generation),
+            Fake<jmethodID>(2));
+  EXPECT_EQ(IdTableT::FieldId<StaticFieldId>().LoadAndMaybeInit(
+                unexpected_field, field_generation),
+            Fake<jfieldID>(3));
+}
+
+}  // namespace
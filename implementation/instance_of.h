@@ -0,0 +1,87 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_INSTANCE_OF_H_
+#define JNI_BIND_IMPLEMENTATION_INSTANCE_OF_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include "implementation/class_ref.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/global_object.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_type.h"
+#include "implementation/jvm.h"
+#include "implementation/local_object.h"
+#include "implementation/promotion_mechanics_tags.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Returns true if `obj` (any object wrapper, or a `jobject`) is an instance of
+// `class_v` or one of its subclasses.  As with Java's `instanceof`, null is an
+// instance of nothing.
+//
+// The `jclass` is the one cached for `class_v`, so this is a single JNI call.
+// For non-default loaders, `class_v` is loaded by `obj`'s loader.
+template <const auto& class_v, const auto& class_loader_v = kDefaultClassLoader,
+          const auto& jvm_v = kDefaultJvm, typename ObjectT>
+bool IsInstance(const ObjectT& obj) {
+  jobject object = static_cast<jobject>(obj);
+  if (object == nullptr) {
+    return false;
+  }
+
+  return JniHelper::IsInstanceOf(
+      object, ClassRef_t<JniT<jobject, class_v, class_loader_v,
+                              jvm_v>>::GetAndMaybeLoadClassRef(object));
+}
+
+// Casts `obj` to `class_v` if it is an instance of it (see `IsInstance`),
+// transferring ownership.  Otherwise returns null and `obj` is left untouched.
+//
+//   LocalObject<kShape> shape = ...;
+//   LocalObject<kCircle> circle = DynamicCast<kCircle>(std::move(shape));
+//   if (static_cast<jobject>(circle) != nullptr) {
+//     circle.Call<"radius">();
+//   }
+template <const auto& class_v, const auto& class_in_v,
+          const auto& class_loader_v, const auto& jvm_v>
+LocalObject<class_v, class_loader_v, jvm_v> DynamicCast(
+    LocalObject<class_in_v, class_loader_v, jvm_v>&& obj) {
+  if (!IsInstance<class_v, class_loader_v, jvm_v>(obj)) {
+    return LocalObject<class_v, class_loader_v, jvm_v>{nullptr};
+  }
+
+  return LocalObject<class_v, class_loader_v, jvm_v>{AdoptLocal{},
+                                                     obj.Release()};
+}
+
+template <const auto& class_v, const auto& class_in_v,
+          const auto& class_loader_v, const auto& jvm_v>
+GlobalObject<class_v, class_loader_v, jvm_v> DynamicCast(
+    GlobalObject<class_in_v, class_loader_v, jvm_v>&& obj) {
+  if (!IsInstance<class_v, class_loader_v, jvm_v>(obj)) {
+    return GlobalObject<class_v, class_loader_v, jvm_v>{nullptr};
+  }
+
+  return GlobalObject<class_v, class_loader_v, jvm_v>{AdoptGlobal{},
+                                                      obj.Release()};
+}
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_INSTANCE_OF_H_
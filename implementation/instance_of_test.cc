@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utility>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::AdoptGlobal;
+using ::jni::AdoptLocal;
+using ::jni::Class;
+using ::jni::DynamicCast;
+using ::jni::Extends;
+using ::jni::Fake;
+using ::jni::GlobalObject;
+using ::jni::IsInstance;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::test::AsGlobal;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Return;
+using ::testing::StrEq;
+
+static constexpr Class kShape{"com/google/Shape"};
+static constexpr Class kCircle{"com/google/Circle", Extends{kShape},
+                               Method{"radius", jni::Return<jfloat>{}}};
+
+TEST_F(JniTest, IsInstance_UsesTheCachedClass) {
+  EXPECT_CALL(*env_, FindClass).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(StrEq("com/google/Circle")))
+      .WillOnce(Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, IsInstanceOf(Fake<jobject>(1), AsGlobal(Fake<jclass>(1))))
+      .WillRepeatedly(Return(JNI_TRUE));
+  EXPECT_CALL(*env_, IsInstanceOf(Fake<jobject>(2), AsGlobal(Fake<jclass>(1))))
+      .WillRepeatedly(Return(JNI_FALSE));
+
+  LocalObject<kShape> circle{AdoptLocal{}, Fake<jobject>(1)};
+  LocalObject<kShape> square{AdoptLocal{}, Fake<jobject>(2)};
+
+  EXPECT_TRUE(IsInstance<kCircle>(circle));
+  EXPECT_TRUE(IsInstance<kCircle>(Fake<jobject>(1)));
+  EXPECT_FALSE(IsInstance<kCircle>(square));
+}
+
+TEST_F(JniTest, IsInstance_NullIsAnInstanceOfNothing) {
+  EXPECT_CALL(*env_, IsInstanceOf).Times(0);
+
+  EXPECT_FALSE(IsInstance<kCircle>(LocalObject<kShape>{nullptr}));
+}
+
+TEST_F(JniTest, DynamicCast_TransfersOwnershipOnlyOnSuccess) {
+  EXPECT_CALL(*env_, IsInstanceOf(Fake<jobject>(1), _))
+      .WillOnce(Return(JNI_TRUE));
+  EXPECT_CALL(*env_, IsInstanceOf(Fake<jobject>(2), _))
+      .WillOnce(Return(JNI_FALSE));
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(1))).Times(1);
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("radius"), StrEq("()F")));
+
+  LocalObject<kShape> shape_1{AdoptLocal{}, Fake<jobject>(1)};
+  LocalObject<kShape> shape_2{AdoptLocal{}, Fake<jobject>(2)};
+
+  LocalObject<kCircle> circle = DynamicCast<kCircle>(std::move(shape_1));
+  EXPECT_EQ(static_cast<jobject>(circle), Fake<jobject>(1));
+  EXPECT_EQ(static_cast<jobject>(shape_1), nullptr);
+  circle.Call<"radius">();
+
+  LocalObject<kCircle> not_a_circle = DynamicCast<kCircle>(std::move(shape_2));
+  EXPECT_EQ(static_cast<jobject>(not_a_circle), nullptr);
+  EXPECT_EQ(static_cast<jobject>(shape_2), Fake<jobject>(2));
+}
+
+TEST_F(JniTest, DynamicCast_SupportsGlobals) {
+  EXPECT_CALL(*env_, IsInstanceOf).WillOnce(Return(JNI_TRUE));
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+
+  GlobalObject<kShape> shape{AdoptGlobal{}, AsGlobal(Fake<jobject>(1))};
+  GlobalObject<kCircle> circle = DynamicCast<kCircle>(std::move(shape));
+
+  EXPECT_EQ(static_cast<jobject>(circle), AsGlobal(Fake<jobject>(1)));
+}
+
+}  // namespace
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_IMPLEMENTATION_INVOKE_ALL_H_
+#define JNI_BIND_IMPLEMENTATION_INVOKE_ALL_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/bound_method.h"
+#include "implementation/jni_helper/jni_array_helper.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/local_array.h"
+#include "implementation/local_object.h"
+#include "jni_dep.h"
+#include "metaprogramming/string_literal.h"
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif  // __cplusplus >= 202002L
+
+namespace jni {
+
+#if __cplusplus >= 202002L
+// Number of array elements whose local references share one local frame.
+inline constexpr std::size_t kInvokeAllFrameSize = 512;
+
+template <const auto& class_v, metaprogramming::StringLiteral method_name,
+          typename... Args>
+struct InvokeAllHelper {
+  using BoundMethodT = BoundMethod<class_v, method_name, std::decay_t<Args>...>;
+  using ReturnT = decltype(std::declval<BoundMethodT>()(
+      jobject{}, std::declval<std::decay_t<Args>>()...));
+
+  static_assert(std::is_void_v<ReturnT> || std::is_arithmetic_v<ReturnT>,
+                "InvokeAll only supports methods returning void or a "
+                "primitive, object results would need a local per call.");
+
+  // Invokes on `object_at(i)` for every `i` in [0, size).  Results, if any,
+  // are written to `results[i]`.
+  //
+  // Stops at the first call that throws, leaving the exception pending and
+  // the remaining results untouched.
+  template <typename ObjectAt, typename ResultSpan>
+  static void Run(std::size_t size, ObjectAt&& object_at, ResultSpan results,
+                  const Args&... args) {
+    if constexpr (!std::is_void_v<ReturnT>) {
+      assert(results.size() >= size);
+    }
+
+    const BoundMethodT method;
+
+    for (std::size_t i = 0; i < size; ++i) {
+      if constexpr (std::is_void_v<ReturnT>) {
+        method(object_at(i), args...);
+      } else {
+        results[i] = method(object_at(i), args...);
+      }
+
+      if (JniHelper::ExceptionCheck()) {
+        return;
+      }
+    }
+  }
+
+  // As above, but fetches each element of `array` within a local frame of
+  // `kInvokeAllFrameSize` elements, so one `DeleteLocalRef` per element is
+  // replaced with one `PopLocalFrame` per chunk.
+  //
+  // If a frame can't be pushed (an `OutOfMemoryError` is then pending), or a
+  // call throws, no further elements are visited and the exception is left
+  // pending.
+  template <typename ResultSpan>
+  static void RunOverArray(jobjectArray array, std::size_t size,
+                           ResultSpan results, const Args&... args) {
+    if constexpr (!std::is_void_v<ReturnT>) {
+      assert(results.size() >= size);
+    }
+
+    const BoundMethodT method;
+
+    for (std::size_t start = 0; start < size; start += kInvokeAllFrameSize) {
+      const std::size_t end = std::min(size, start + kInvokeAllFrameSize);
+      if (JniHelper::PushLocalFrame(static_cast<jint>(end - start)) != JNI_OK) {
+        return;
+      }
+
+      bool threw = false;
+      for (std::size_t i = start; i < end; ++i) {
+        jobject object = JniArrayHelper<jobject, 1>::GetArrayElement(array, i);
+        if ((threw = JniHelper::ExceptionCheck())) {
+          break;
+        }
+
+        if constexpr (std::is_void_v<ReturnT>) {
+          method(object, args...);
+        } else {
+          results[i] = method(object, args...);
+        }
+
+        if ((threw = JniHelper::ExceptionCheck())) {
+          break;
+        }
+      }
+
+      JniHelper::PopLocalFrame(nullptr);
+
+      if (threw) {
+        return;
+      }
+    }
+  }
+};
+
+// Invokes `method_name` on every object of `objects` with the same `args`.
+// The jclass and jmethodID are resolved once for the whole batch, and for
+// primitive returning methods, results are written directly into `results`
+// (which must be at least as long as `objects`).
+//
+//   std::vector<jint> out(arr.Length());
+//   jni::InvokeAll<"foo">(arr, std::span{out}, 123);
+//   jni::InvokeAll<"bar">(std::span{vector_of_local_objects});
+template <metaprogramming::StringLiteral method_name, const auto& class_v,
+          typename ResultT, typename... Args>
+void InvokeAll(LocalArray<jobject, 1, class_v>& objects,
+               std::span<ResultT> results, const Args&... args) {
+  using Helper = InvokeAllHelper<class_v, method_name, Args...>;
+  static_assert(std::is_same_v<typename Helper::ReturnT, ResultT>,
+                "Result span must match the method's return type.");
+
+  Helper::RunOverArray(
+      static_cast<jobjectArray>(static_cast<jobject>(objects)),
+      objects.Length(), results, args...);
+}
+
+template <metaprogramming::StringLiteral method_name, const auto& class_v,
+          typename... Args>
+void InvokeAll(LocalArray<jobject, 1, class_v>& objects, const Args&... args) {
+  using Helper = InvokeAllHelper<class_v, method_name, Args...>;
+  static_assert(std::is_void_v<typename Helper::ReturnT>,
+                "Pass a result span for methods which return a value.");
+
+  Helper::RunOverArray(
+      static_cast<jobjectArray>(static_cast<jobject>(objects)),
+      objects.Length(), nullptr, args...);
+}
+
+template <metaprogramming::StringLiteral method_name, const auto& class_v,
+          typename ResultT, typename... Args>
+void InvokeAll(std::span<LocalObject<class_v>> objects,
+               std::span<ResultT> results, const Args&... args) {
+  using Helper = InvokeAllHelper<class_v, method_name, Args...>;
+  static_assert(std::is_same_v<typename Helper::ReturnT, ResultT>,
+                "Result span must match the method's return type.");
+
+  Helper::Run(
+      objects.size(),
+      [&](std::size_t i) { return static_cast<jobject>(objects[i]); }, results,
+      args...);
+}
+
+template <metaprogramming::StringLiteral method_name, const auto& class_v,
+          typename... Args>
+void InvokeAll(std::span<LocalObject<class_v>> objects, const Args&... args) {
+  using Helper = InvokeAllHelper<class_v, method_name, Args...>;
+  static_assert(std::is_void_v<typename Helper::ReturnT>,
+                "Pass a result span for methods which return a value.");
+
+  Helper::Run(
+      objects.size(),
+      [&](std::size_t i) { return static_cast<jobject>(objects[i]); }, nullptr,
+      args...);
+}
+#endif  // __cplusplus >= 202002L
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_INVOKE_ALL_H_
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <span>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::Fake;
+using ::jni::InvokeAll;
+using ::jni::kInvokeAllFrameSize;
+using ::jni::LocalArray;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::StrEq;
+
+static constexpr Class kClass{
+    "kClass",
+    Method{"Foo", Return<jint>{}, Params<jint>{}},
+    Method{"Bar", Return<void>{}, Params<>{}},
+};
+
+TEST_F(JniTest, InvokeAll_ResolvesMethodOnceForArrays) {
+  const std::size_t kSize = kInvokeAllFrameSize + 1;
+  std::vector<jint> results(kSize);
+
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(testing::Return(kSize));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("(I)I"))).Times(1);
+  EXPECT_CALL(*env_, GetObjectArrayElement)
+      .Times(kSize)
+      .WillRepeatedly(testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, CallIntMethodV(Fake<jobject>(2), _, _))
+      .Times(kSize)
+      .WillRepeatedly(testing::Return(7));
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(2))).Times(0);
+  {
+    InSequence seq;
+    EXPECT_CALL(*env_, PushLocalFrame(kInvokeAllFrameSize));
+    EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+    EXPECT_CALL(*env_, PushLocalFrame(1));
+    EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+  }
+
+  LocalArray<jobject, 1, kClass> arr{Fake<jobjectArray>()};
+  InvokeAll<"Foo">(arr, std::span{results}, 5);
+
+  EXPECT_EQ(results, std::vector<jint>(kSize, 7));
+}
+
+TEST_F(JniTest, InvokeAll_InvokesVoidMethodsOnArrays) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(testing::Return(3));
+  EXPECT_CALL(*env_, CallVoidMethodV).Times(3);
+  EXPECT_CALL(*env_, PushLocalFrame(3));
+  EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+
+  LocalArray<jobject, 1, kClass> arr{Fake<jobjectArray>()};
+  InvokeAll<"Bar">(arr);
+}
+
+TEST_F(JniTest, InvokeAll_InvokesOverSpansOfObjects) {
+  std::vector<LocalObject<kClass>> objects;
+  objects.emplace_back(Fake<jobject>(1));
+  objects.emplace_back(Fake<jobject>(2));
+  std::vector<jint> results(2);
+
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), _)).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Bar"), _)).Times(1);
+  EXPECT_CALL(*env_, CallIntMethodV)
+      .WillOnce(testing::Return(1))
+      .WillOnce(testing::Return(2));
+  EXPECT_CALL(*env_, CallVoidMethodV).Times(2);
+  EXPECT_CALL(*env_, PushLocalFrame).Times(0);
+
+  InvokeAll<"Foo">(std::span{objects}, std::span{results}, 5);
+  InvokeAll<"Bar">(std::span{objects});
+
+  EXPECT_EQ(results, (std::vector<jint>{1, 2}));
+}
+
+TEST_F(JniTest, InvokeAll_StopsAtTheFirstException) {
+  std::vector<jint> results(4, -1);
+
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(testing::Return(4));
+  EXPECT_CALL(*env_, GetObjectArrayElement).Times(2);
+  EXPECT_CALL(*env_, CallIntMethodV)
+      .WillOnce(testing::Return(1))
+      .WillOnce(testing::Return(2));
+  // Checked after each fetch and each call, the second call throws.
+  EXPECT_CALL(*env_, ExceptionCheck)
+      .WillOnce(testing::Return(JNI_FALSE))
+      .WillOnce(testing::Return(JNI_FALSE))
+      .WillOnce(testing::Return(JNI_FALSE))
+      .WillOnce(testing::Return(JNI_TRUE));
+  EXPECT_CALL(*env_, PushLocalFrame(4));
+  EXPECT_CALL(*env_, PopLocalFrame(nullptr));
+
+  LocalArray<jobject, 1, kClass> arr{Fake<jobjectArray>()};
+  InvokeAll<"Foo">(arr, std::span{results}, 5);
+
+  EXPECT_EQ(results, (std::vector<jint>{1, 2, -1, -1}));
+}
+
+TEST_F(JniTest, InvokeAll_StopsOverSpansAtTheFirstException) {
+  std::vector<LocalObject<kClass>> objects;
+  objects.emplace_back(Fake<jobject>(1));
+  objects.emplace_back(Fake<jobject>(2));
+
+  EXPECT_CALL(*env_, CallVoidMethodV).Times(1);
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_TRUE));
+
+  InvokeAll<"Bar">(std::span{objects});
+}
+
+TEST_F(JniTest, InvokeAll_DoesNothingIfTheLocalFrameCantBePushed) {
+  EXPECT_CALL(*env_, GetArrayLength).WillOnce(testing::Return(3));
+  EXPECT_CALL(*env_, PushLocalFrame(3)).WillOnce(testing::Return(JNI_ERR));
+  EXPECT_CALL(*env_, GetObjectArrayElement).Times(0);
+  EXPECT_CALL(*env_, CallVoidMethodV).Times(0);
+  EXPECT_CALL(*env_, PopLocalFrame).Times(0);
+
+  LocalArray<jobject, 1, kClass> arr{Fake<jobjectArray>()};
+  InvokeAll<"Bar">(arr);
+}
+
+}  // namespace
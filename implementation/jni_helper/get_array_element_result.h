@@ -25,7 +25,9 @@ namespace jni {
 template <typename SpanType>
 struct GetArrayElementsResult {
   SpanType* ptr_;
-  jboolean is_copy;
+
+  // Assume a copy unless the VM says otherwise.
+  jboolean is_copy = JNI_TRUE;
 };
 
 }  // namespace jni
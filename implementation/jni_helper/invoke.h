@@ -47,6 +47,17 @@ struct InvokeHelper<void, 0, false> {
 
     jni::JniEnv::GetEnv()->CallVoidMethod(object, method_id,
                                           std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static void InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                      const jvalue* args) {
+#ifdef DRY_RUN
+#else
+    Trace(metaprogramming::LambdaToStr(STR("CallVoidMethodA")), object, clazz,
+          method_id, args);
+
+    jni::JniEnv::GetEnv()->CallVoidMethodA(object, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -67,6 +78,18 @@ struct InvokeHelper<jboolean, 0, false> {
 
     return jni::JniEnv::GetEnv()->CallBooleanMethod(object, method_id,
                                                     std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jboolean InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                          const jvalue* args) {
+#ifdef DRY_RUN
+    return Fake<jboolean>();
+#else
+    Trace(metaprogramming::LambdaToStr(STR("CallBooleanMethodA")), object,
+          clazz, method_id, args);
+
+    return jni::JniEnv::GetEnv()->CallBooleanMethodA(object, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -84,6 +107,18 @@ struct InvokeHelper<jint, 0, false> {
 #else
     return jni::JniEnv::GetEnv()->CallIntMethod(object, method_id,
                                                 std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jint InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                      const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallIntMethodA")), object, clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jint>();
+#else
+    return jni::JniEnv::GetEnv()->CallIntMethodA(object, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -101,6 +136,18 @@ struct InvokeHelper<jlong, 0, false> {
 #else
     return jni::JniEnv::GetEnv()->CallLongMethod(object, method_id,
                                                  std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jlong InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                       const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallLongMethodA")), object, clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jlong>();
+#else
+    return jni::JniEnv::GetEnv()->CallLongMethodA(object, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -119,6 +166,19 @@ struct InvokeHelper<jfloat, 0, false> {
 #else
     return jni::JniEnv::GetEnv()->CallFloatMethod(object, method_id,
                                                   std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jfloat InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                        const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallFloatMethodA")), object, clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    //    return Fake<jfloat>();
+    return 123.f;
+#else
+    return jni::JniEnv::GetEnv()->CallFloatMethodA(object, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -137,6 +197,19 @@ struct InvokeHelper<jdouble, 0, false> {
 #else
     return jni::JniEnv::GetEnv()->CallDoubleMethod(object, method_id,
                                                    std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jdouble InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallDoubleMethodA")), object, clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    // return Fake<jdouble>();
+    return 123.f;
+#else
+    return jni::JniEnv::GetEnv()->CallDoubleMethodA(object, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -156,6 +229,18 @@ struct InvokeHelper<jobject, 0, false> {
 #else
     return jni::JniEnv::GetEnv()->CallObjectMethod(object, method_id,
                                                    std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jobject InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallObjectMethodA")), object, clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobject>();
+#else
+    return jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -173,6 +258,18 @@ struct InvokeHelper<jstring, 0, false> {
 #else
     return jni::JniEnv::GetEnv()->CallObjectMethod(object, method_id,
                                                    std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jobject InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallObjectMethodA")), object, clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jstring>();
+#else
+    return jni::JniEnv::GetEnv()->CallObjectMethodA(object, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -194,6 +291,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jboolean>, kRank, false> {
 #else
     return static_cast<jbooleanArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jbooleanArray InvokeA(jobject object, jclass clazz,
+                               jmethodID method_id, const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jbooleanArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jbooleanArray>();
+#else
+    return static_cast<jbooleanArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -212,6 +323,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jbyte>, kRank, false> {
 #else
     return static_cast<jbyteArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jbyteArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jbyteArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jbyteArray>();
+#else
+    return static_cast<jbyteArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -230,6 +355,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jchar>, kRank, false> {
 #else
     return static_cast<jcharArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jcharArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jcharArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jcharArray>();
+#else
+    return static_cast<jcharArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -248,6 +387,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jshort>, kRank, false> {
 #else
     return static_cast<jshortArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jshortArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                             const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jshortArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jshortArray>();
+#else
+    return static_cast<jshortArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -266,6 +419,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jint>, kRank, false> {
 #else
     return static_cast<jintArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jintArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                           const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jintArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jintArray>();
+#else
+    return static_cast<jintArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -284,6 +451,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jlong>, kRank, false> {
 #else
     return static_cast<jlongArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jlongArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jlongArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jlongArray>();
+#else
+    return static_cast<jlongArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -302,6 +483,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jfloat>, kRank, false> {
 #else
     return static_cast<jfloatArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jfloatArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                             const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jfloatArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jfloatArray>();
+#else
+    return static_cast<jfloatArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -320,6 +515,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jdouble>, kRank, false> {
 #else
     return static_cast<jdoubleArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jdoubleArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jdoubleArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jdoubleArray>();
+#else
+    return static_cast<jdoubleArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -340,6 +549,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jarray>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -358,6 +581,20 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jobject>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -379,6 +616,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jboolean>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -397,6 +648,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jbyte>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -415,6 +680,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jchar>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -433,6 +712,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jshort>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -451,6 +744,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jint>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -468,6 +775,19 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jfloat>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -486,6 +806,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jdouble>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -504,6 +838,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jlong>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -524,6 +872,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jarray>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -542,6 +904,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jobject>, kRank, false> {
 #else
     return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethod(
         object, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(jni::JniEnv::GetEnv()->CallObjectMethodA(
+        object, method_id, args));
 #endif
   }
 };
@@ -0,0 +1,979 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_METHOD_INVOKE_NONVIRTUAL_H_
+#define JNI_BIND_METHOD_INVOKE_NONVIRTUAL_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "jni_env.h"
+#include "jni_dep.h"
+#include "metaprogramming/lambda_string.h"
+#include "trace.h"
+
+namespace jni {
+
+// Mirrors `InvokeHelper` but dispatches through `CallNonvirtual<Type>Method`.
+// The JVM invokes the implementation found on `clazz` directly rather than
+// resolving the receiver's vtable (or itable) entry.
+template <typename ReturnType, std::size_t kRank>
+class InvokeNonvirtualHelper {};
+
+////////////////////////////////////////////////////////////////////////////////
+// Rank 0 type: void
+//    void is special, but for symmetry it uses rank 0 with primitives.
+////////////////////////////////////////////////////////////////////////////////
+template <>
+struct InvokeNonvirtualHelper<void, 0> {
+  template <typename... Ts>
+  static void Invoke(jobject object, jclass clazz, jmethodID method_id,
+                     Ts&&... ts) {
+#ifdef DRY_RUN
+#else
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualVoidMethod")), object,
+          clazz, method_id, ts...);
+
+    jni::JniEnv::GetEnv()->CallNonvirtualVoidMethod(object, clazz, method_id,
+                                                    std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static void InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                      const jvalue* args) {
+#ifdef DRY_RUN
+#else
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualVoidMethodA")),
+          object, clazz, method_id, args);
+
+    jni::JniEnv::GetEnv()->CallNonvirtualVoidMethodA(object, clazz, method_id,
+                                                     args);
+#endif  // DRY_RUN
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Rank 0 types, i.e. the primitive type itself (e.g. int).
+////////////////////////////////////////////////////////////////////////////////
+template <>
+struct InvokeNonvirtualHelper<jboolean, 0> {
+  template <typename... Ts>
+  static jboolean Invoke(jobject object, jclass clazz, jmethodID method_id,
+                         Ts&&... ts) {
+#ifdef DRY_RUN
+    return Fake<jboolean>();
+#else
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualBooleanMethod")),
+          object, clazz, method_id, ts...);
+
+    return jni::JniEnv::GetEnv()->CallNonvirtualBooleanMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jboolean InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                          const jvalue* args) {
+#ifdef DRY_RUN
+    return Fake<jboolean>();
+#else
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualBooleanMethodA")),
+          object, clazz, method_id, args);
+
+    return jni::JniEnv::GetEnv()->CallNonvirtualBooleanMethodA(object, clazz,
+                                                               method_id, args);
+#endif  // DRY_RUN
+  }
+};
+
+template <>
+struct InvokeNonvirtualHelper<jint, 0> {
+  template <typename... Ts>
+  static jint Invoke(jobject object, jclass clazz, jmethodID method_id,
+                     Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualIntMethod")), object,
+          clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jint>();
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualIntMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jint InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                      const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualIntMethodA")), object,
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jint>();
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualIntMethodA(object, clazz,
+                                                           method_id, args);
+#endif  // DRY_RUN
+  }
+};
+
+template <>
+struct InvokeNonvirtualHelper<jlong, 0> {
+  template <typename... Ts>
+  static jlong Invoke(jobject object, jclass clazz, jmethodID method_id,
+                      Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualLongMethod")), object,
+          clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jlong>();
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualLongMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jlong InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                       const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualLongMethodA")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jlong>();
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualLongMethodA(object, clazz,
+                                                            method_id, args);
+#endif  // DRY_RUN
+  }
+};
+
+template <>
+struct InvokeNonvirtualHelper<jfloat, 0> {
+  template <typename... Ts>
+  static jfloat Invoke(jobject object, jclass clazz, jmethodID method_id,
+                       Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualFloatMethod")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    //    return Fake<jfloat>();
+    return 123.f;
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualFloatMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jfloat InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                        const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualFloatMethodA")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    //    return Fake<jfloat>();
+    return 123.f;
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualFloatMethodA(object, clazz,
+                                                             method_id, args);
+#endif  // DRY_RUN
+  }
+};
+
+template <>
+struct InvokeNonvirtualHelper<jdouble, 0> {
+  template <typename... Ts>
+  static jdouble Invoke(jobject object, jclass clazz, jmethodID method_id,
+                        Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualDoubleMethod")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    // return Fake<jdouble>();
+    return 123.f;
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualDoubleMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jdouble InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualDoubleMethodA")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    // return Fake<jdouble>();
+    return 123.f;
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualDoubleMethodA(object, clazz,
+                                                              method_id, args);
+#endif  // DRY_RUN
+  }
+};
+
+template <>
+struct InvokeNonvirtualHelper<jobject, 0> {
+  // This always returns a local reference which should be embedded in type
+  // information wherever this is used.
+  template <typename... Ts>
+  static jobject Invoke(jobject object, jclass clazz, jmethodID method_id,
+                        Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualObjectMethod")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobject>();
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jobject InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualObjectMethodA")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobject>();
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                              method_id, args);
+#endif  // DRY_RUN
+  }
+};
+
+template <>
+struct InvokeNonvirtualHelper<jstring, 0> {
+  template <typename... Ts>
+  static jobject Invoke(jobject object, jclass clazz, jmethodID method_id,
+                        Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualObjectMethod")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jstring>();
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+        object, clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jobject InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallNonvirtualObjectMethodA")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jstring>();
+#else
+    return jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                              method_id, args);
+#endif  // DRY_RUN
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Rank 1 types, i.e. single dimension arrays (e.g. int[]).
+////////////////////////////////////////////////////////////////////////////////
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jboolean>, kRank> {
+  template <typename... Ts>
+  static jbooleanArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                              Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jbooleanArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jbooleanArray>();
+#else
+    return static_cast<jbooleanArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jbooleanArray InvokeA(jobject object, jclass clazz,
+                               jmethodID method_id, const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jbooleanArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jbooleanArray>();
+#else
+    return static_cast<jbooleanArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif  // DRY_RUN
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jbyte>, kRank> {
+  template <typename... Ts>
+  static jbyteArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                           Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jbyteArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jbyteArray>();
+#else
+    return static_cast<jbyteArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jbyteArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jbyteArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jbyteArray>();
+#else
+    return static_cast<jbyteArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif  // DRY_RUN
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jchar>, kRank> {
+  template <typename... Ts>
+  static jcharArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                           Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jcharArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jcharArray>();
+#else
+    return static_cast<jcharArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jcharArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jcharArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jcharArray>();
+#else
+    return static_cast<jcharArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif  // DRY_RUN
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jshort>, kRank> {
+  template <typename... Ts>
+  static jshortArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                            Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jshortArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jshortArray>();
+#else
+    return static_cast<jshortArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jshortArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                             const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jshortArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jshortArray>();
+#else
+    return static_cast<jshortArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jint>, kRank> {
+  template <typename... Ts>
+  static jintArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                          Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jintArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jintArray>();
+#else
+    return static_cast<jintArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jintArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                           const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jintArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jintArray>();
+#else
+    return static_cast<jintArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jlong>, kRank> {
+  template <typename... Ts>
+  static jlongArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                           Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jlongArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jlongArray>();
+#else
+    return static_cast<jlongArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jlongArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jlongArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jlongArray>();
+#else
+    return static_cast<jlongArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jfloat>, kRank> {
+  template <typename... Ts>
+  static jfloatArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                            Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jfloatArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jfloatArray>();
+#else
+    return static_cast<jfloatArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jfloatArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                             const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jfloatArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jfloatArray>();
+#else
+    return static_cast<jfloatArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jdouble>, kRank> {
+  template <typename... Ts>
+  static jdoubleArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jdoubleArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jdoubleArray>();
+#else
+    return static_cast<jdoubleArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jdoubleArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jdoubleArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jdoubleArray>();
+#else
+    return static_cast<jdoubleArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jarray>, kRank> {
+  // Arrays of arrays (which this invoke represents) return object arrays
+  // (arrays themselves are objects, ergo object arrays).
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank == 1), jobject>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank 1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank 1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Rank 2+ types, i.e. multi-dimension arrays (e.g. int[][], int[][][]).
+////////////////////////////////////////////////////////////////////////////////
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jboolean>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jbyte>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jchar>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jshort>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jint>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jfloat>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jdouble>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jlong>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jarray>, kRank> {
+  // Arrays of arrays (which this invoke represents) return object arrays
+  // (arrays themselves are objects, ergo object arrays).
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+template <std::size_t kRank>
+struct InvokeNonvirtualHelper<std::enable_if_t<(kRank > 1), jobject>, kRank> {
+  template <typename... Ts>
+  static jobjectArray Invoke(jobject object, jclass clazz, jmethodID method_id,
+                             Ts&&... ts) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethod (jobjectArray), Rank >1")),
+          object, clazz, method_id, ts...);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethod(
+            object, clazz, method_id, std::forward<Ts>(ts)...));
+#endif
+  }
+
+  static jobjectArray InvokeA(jobject object, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallNonvirtualObjectMethodA (jobjectArray), Rank >1")),
+          object, clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallNonvirtualObjectMethodA(object, clazz,
+                                                           method_id, args));
+#endif
+  }
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_METHOD_INVOKE_NONVIRTUAL_H_
@@ -43,6 +43,17 @@ struct InvokeHelper<void, 0, true> {
 #else
     jni::JniEnv::GetEnv()->CallStaticVoidMethod(clazz, method_id,
                                                 std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static void InvokeA(jobject, jclass clazz, jmethodID method_id,
+                      const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticVoidMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->CallStaticVoidMethodA(clazz, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -63,6 +74,19 @@ struct InvokeHelper<jboolean, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticBooleanMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jboolean InvokeA(jobject, jclass clazz, jmethodID method_id,
+                          const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticBooleanMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jboolean>();
+#else
+    return jni::JniEnv::GetEnv()->CallStaticBooleanMethodA(clazz, method_id,
+                                                           args);
 #endif  // DRY_RUN
   }
 };
@@ -80,6 +104,18 @@ struct InvokeHelper<jbyte, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticByteMethod(clazz, method_id,
                                                        std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jboolean InvokeA(jobject, jclass clazz, jmethodID method_id,
+                          const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticByteMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jboolean>();
+#else
+    return jni::JniEnv::GetEnv()->CallStaticByteMethodA(clazz, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -97,6 +133,18 @@ struct InvokeHelper<jchar, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticCharMethod(clazz, method_id,
                                                        std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jboolean InvokeA(jobject, jclass clazz, jmethodID method_id,
+                          const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticCharMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jboolean>();
+#else
+    return jni::JniEnv::GetEnv()->CallStaticCharMethodA(clazz, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -114,6 +162,19 @@ struct InvokeHelper<jshort, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticShortMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jboolean InvokeA(jobject, jclass clazz, jmethodID method_id,
+                          const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticShortMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jboolean>();
+#else
+    return jni::JniEnv::GetEnv()->CallStaticShortMethodA(clazz, method_id,
+                                                         args);
 #endif  // DRY_RUN
   }
 };
@@ -130,6 +191,18 @@ struct InvokeHelper<jint, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticIntMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jint InvokeA(jobject, jclass clazz, jmethodID method_id,
+                      const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticIntMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jint>();
+#else
+    return jni::JniEnv::GetEnv()->CallStaticIntMethodA(clazz, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -146,6 +219,18 @@ struct InvokeHelper<jlong, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticLongMethod(clazz, method_id,
                                                        std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jlong InvokeA(jobject, jclass clazz, jmethodID method_id,
+                       const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticLongMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jlong>();
+#else
+    return jni::JniEnv::GetEnv()->CallStaticLongMethodA(clazz, method_id, args);
 #endif  // DRY_RUN
   }
 };
@@ -162,6 +247,19 @@ struct InvokeHelper<jfloat, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticFloatMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jfloat InvokeA(jobject, jclass clazz, jmethodID method_id,
+                        const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticFloatMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return 123.f;
+#else
+    return jni::JniEnv::GetEnv()->CallStaticFloatMethodA(clazz, method_id,
+                                                         args);
 #endif  // DRY_RUN
   }
 };
@@ -179,6 +277,19 @@ struct InvokeHelper<jdouble, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticDoubleMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jdouble InvokeA(jobject, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticDoubleMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return 123.;
+#else
+    return jni::JniEnv::GetEnv()->CallStaticDoubleMethodA(clazz, method_id,
+                                                          args);
 #endif  // DRY_RUN
   }
 };
@@ -198,6 +309,19 @@ struct InvokeHelper<jobject, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticObjectMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jobject InvokeA(jobject, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobject>();
+#else
+    return jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                          args);
 #endif  // DRY_RUN
   }
 };
@@ -215,6 +339,19 @@ struct InvokeHelper<jstring, 0, true> {
 #else
     return jni::JniEnv::GetEnv()->CallStaticObjectMethod(
         clazz, method_id, std::forward<Ts>(ts)...);
+#endif  // DRY_RUN
+  }
+
+  static jobject InvokeA(jobject, jclass clazz, jmethodID method_id,
+                         const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA")), clazz,
+          method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobject>();
+#else
+    return jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id,
+                                                          args);
 #endif  // DRY_RUN
   }
 };
@@ -236,6 +373,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jboolean>, kRank, true> {
     return static_cast<jbooleanArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jbooleanArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                               const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jbooleanArray>();
+#else
+    return static_cast<jbooleanArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -254,6 +404,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jbyte>, kRank, true> {
     return static_cast<jbyteArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jbyteArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jbyteArray>();
+#else
+    return static_cast<jbyteArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -272,6 +435,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jchar>, kRank, true> {
     return static_cast<jcharArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jcharArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jcharArray>();
+#else
+    return static_cast<jcharArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -290,6 +466,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jshort>, kRank, true> {
     return static_cast<jshortArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jshortArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                             const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jshortArray>();
+#else
+    return static_cast<jshortArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -307,6 +496,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jint>, kRank, true> {
 #else
     return static_cast<jintArray>(jni::JniEnv::GetEnv()->CallStaticObjectMethod(
         clazz, method_id, std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jintArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                           const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jintArray>();
+#else
+    return static_cast<jintArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -325,6 +527,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jfloat>, kRank, true> {
     return static_cast<jfloatArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jfloatArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                             const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jfloatArray>();
+#else
+    return static_cast<jfloatArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -343,6 +558,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jdouble>, kRank, true> {
     return static_cast<jdoubleArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jdoubleArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jdoubleArray>();
+#else
+    return static_cast<jdoubleArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -361,6 +589,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jlong>, kRank, true> {
     return static_cast<jlongArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jlongArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                            const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jlongArray>();
+#else
+    return static_cast<jlongArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -381,6 +622,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jarray>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -399,6 +653,19 @@ struct InvokeHelper<std::enable_if_t<(kRank == 1), jobject>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(STR("CallStaticObjectMethodA, Rank 1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -421,6 +688,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jboolean>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jboolean), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -440,6 +721,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jbyte>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jbyte), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -459,6 +754,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jchar>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jchar), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -478,6 +787,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jshort>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jshort), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -497,6 +820,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jint>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jint), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -516,6 +853,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jfloat>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jfloat), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -535,6 +886,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jdouble>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jdouble), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -554,6 +919,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jlong>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jlong), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -575,6 +954,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jarray>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jarray), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -594,6 +987,20 @@ struct InvokeHelper<std::enable_if_t<(kRank > 1), jobject>, kRank, true> {
     return static_cast<jobjectArray>(
         jni::JniEnv::GetEnv()->CallStaticObjectMethod(clazz, method_id,
                                                       std::forward<Ts>(ts)...));
+#endif  // DRY_RUN
+  }
+
+  static jobjectArray InvokeA(jobject, jclass clazz, jmethodID method_id,
+                              const jvalue* args) {
+    Trace(metaprogramming::LambdaToStr(
+              STR("CallStaticObjectMethodA (jobject), Rank >1")),
+          clazz, method_id, args);
+
+#ifdef DRY_RUN
+    return Fake<jobjectArray>();
+#else
+    return static_cast<jobjectArray>(
+        jni::JniEnv::GetEnv()->CallStaticObjectMethodA(clazz, method_id, args));
 #endif  // DRY_RUN
   }
 };
@@ -19,6 +19,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "implementation/jni_helper/fake_test_constants.h"
+#include "implementation/jni_helper/invoke_nonvirtual.h"
+#include "implementation/jni_helper/invoke_static.h"
 #include "jni_dep.h"
 #include "jni_test.h"
 
@@ -26,6 +28,7 @@ namespace {
 
 using ::jni::Fake;
 using ::jni::InvokeHelper;
+using ::jni::InvokeNonvirtualHelper;
 using ::jni::test::JniTest;
 using ::testing::_;
 using ::testing::Return;
@@ -123,4 +126,78 @@ TEST_F(JniTest, InvokeHelper_InvokesObjectMethod) {
             Fake<jobject>());
 }
 
+TEST_F(JniTest, InvokeHelper_InvokesIntMethodA) {
+  const jvalue args[2]{{.i = 1}, {.i = 2}};
+
+  EXPECT_CALL(*env_, CallIntMethodA(Fake<jobject>(), Fake<jmethodID>(), args))
+      .WillOnce(Return(123));
+
+  EXPECT_EQ((InvokeHelper<jint, 0, false>::InvokeA(Fake<jobject>(), nullptr,
+                                                   Fake<jmethodID>(), args)),
+            123);
+}
+
+TEST_F(JniTest, InvokeHelper_InvokesObjectMethodA) {
+  EXPECT_CALL(*env_,
+              CallObjectMethodA(Fake<jobject>(), Fake<jmethodID>(), nullptr))
+      .WillOnce(Return(Fake<jobject>()));
+
+  EXPECT_EQ((InvokeHelper<jobject, 0, false>::InvokeA(
+                Fake<jobject>(), nullptr, Fake<jmethodID>(), nullptr)),
+            Fake<jobject>());
+}
+
+TEST_F(JniTest, InvokeHelper_InvokesStaticIntMethodA) {
+  const jvalue args[1]{{.i = 1}};
+
+  EXPECT_CALL(*env_,
+              CallStaticIntMethodA(Fake<jclass>(), Fake<jmethodID>(), args))
+      .WillOnce(Return(123));
+
+  EXPECT_EQ((InvokeHelper<jint, 0, true>::InvokeA(nullptr, Fake<jclass>(),
+                                                  Fake<jmethodID>(), args)),
+            123);
+}
+
+TEST_F(JniTest, InvokeNonvirtualHelper_InvokesVoidMethod) {
+  EXPECT_CALL(*env_, CallNonvirtualVoidMethodV(Fake<jobject>(), Fake<jclass>(),
+                                               Fake<jmethodID>(), _));
+
+  InvokeNonvirtualHelper<void, 0>::Invoke(Fake<jobject>(), Fake<jclass>(),
+                                          Fake<jmethodID>(), 1);
+}
+
+TEST_F(JniTest, InvokeNonvirtualHelper_InvokesIntMethod) {
+  EXPECT_CALL(*env_, CallNonvirtualIntMethodV(Fake<jobject>(), Fake<jclass>(),
+                                              Fake<jmethodID>(), _))
+      .WillOnce(Return(123));
+
+  EXPECT_EQ((InvokeNonvirtualHelper<jint, 0>::Invoke(
+                Fake<jobject>(), Fake<jclass>(), Fake<jmethodID>(), 1, 2)),
+            123);
+}
+
+TEST_F(JniTest, InvokeNonvirtualHelper_InvokesArrayMethod) {
+  EXPECT_CALL(*env_, CallNonvirtualObjectMethodV(
+                         Fake<jobject>(), Fake<jclass>(), Fake<jmethodID>(), _))
+      .WillOnce(Return(Fake<jintArray>()));
+
+  EXPECT_EQ((InvokeNonvirtualHelper<jint, 1>::Invoke(
+                Fake<jobject>(), Fake<jclass>(), Fake<jmethodID>())),
+            Fake<jintArray>());
+}
+
+TEST_F(JniTest, InvokeNonvirtualHelper_InvokesDoubleMethodA) {
+  const jvalue args[1]{{.d = 1.5}};
+
+  EXPECT_CALL(*env_, CallNonvirtualDoubleMethodA(
+                         Fake<jobject>(), Fake<jclass>(), Fake<jmethodID>(),
+                         args))
+      .WillOnce(Return(2.5));
+
+  EXPECT_EQ((InvokeNonvirtualHelper<jdouble, 0>::InvokeA(
+                Fake<jobject>(), Fake<jclass>(), Fake<jmethodID>(), args)),
+            2.5);
+}
+
 }  // namespace
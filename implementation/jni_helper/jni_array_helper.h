@@ -35,6 +35,47 @@ struct JniArrayHelperBase {
     return Fake<std::size_t>();
 #else
     return jni::JniEnv::GetEnv()->GetArrayLength(array);
+#endif  // DRY_RUN
+  }
+
+  // Opens a critical region on this thread until the matching release.
+  static inline void* GetPrimitiveArrayCritical(jarray array) {
+    Trace(metaprogramming::LambdaToStr(STR("GetPrimitiveArrayCritical")),
+          array);
+
+#ifdef DRY_RUN
+    return nullptr;
+#else
+    void* ret =
+        jni::JniEnv::GetEnvForCriticalRegion()->GetPrimitiveArrayCritical(
+            array, nullptr);
+
+    // On failure no region is opened (and an `OutOfMemoryError` is pending).
+    if (ret != nullptr) {
+      jni::JniEnv::EnterCriticalRegion();
+    }
+
+    return ret;
+#endif  // DRY_RUN
+  }
+
+  static inline void ReleasePrimitiveArrayCritical(jarray array,
+                                                   void* native_ptr,
+                                                   bool copy_on_completion) {
+    const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
+    Trace(metaprogramming::LambdaToStr(STR("ReleasePrimitiveArrayCritical")),
+          array, native_ptr, copy_back_mode);
+
+#ifdef DRY_RUN
+#else
+    // Nothing was pinned if `GetPrimitiveArrayCritical` failed.
+    if (native_ptr == nullptr) {
+      return;
+    }
+
+    jni::JniEnv::ExitCriticalRegion();
+    jni::JniEnv::GetEnvForCriticalRegion()->ReleasePrimitiveArrayCritical(
+        array, native_ptr, copy_back_mode);
 #endif  // DRY_RUN
   }
 };
@@ -125,6 +166,32 @@ struct JniArrayHelper<jboolean, 1> : public JniArrayHelperBase {
     const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
     jni::JniEnv::GetEnv()->ReleaseBooleanArrayElements(
         static_cast<jbooleanArray>(array), native_ptr, copy_back_mode);
+#endif  // DRY_RUN
+  }
+
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jboolean* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("GetArrayRegion, jboolean, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->GetBooleanArrayRegion(
+        static_cast<jbooleanArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jboolean* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("SetArrayRegion, jboolean, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->SetBooleanArrayRegion(
+        static_cast<jbooleanArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
 #endif  // DRY_RUN
   }
 };
@@ -169,6 +236,32 @@ struct JniArrayHelper<jbyte, 1> : public JniArrayHelperBase {
     const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
     jni::JniEnv::GetEnv()->ReleaseByteArrayElements(
         static_cast<jbyteArray>(array), native_ptr, copy_back_mode);
+#endif  // DRY_RUN
+  }
+
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jbyte* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("GetArrayRegion, jbyte, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->GetByteArrayRegion(
+        static_cast<jbyteArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jbyte* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("SetArrayRegion, jbyte, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->SetByteArrayRegion(
+        static_cast<jbyteArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
 #endif  // DRY_RUN
   }
 };
@@ -213,6 +306,32 @@ struct JniArrayHelper<jchar, 1> : public JniArrayHelperBase {
     const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
     jni::JniEnv::GetEnv()->ReleaseCharArrayElements(
         static_cast<jcharArray>(array), native_ptr, copy_back_mode);
+#endif  // DRY_RUN
+  }
+
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jchar* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("GetArrayRegion, jchar, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->GetCharArrayRegion(
+        static_cast<jcharArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jchar* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("SetArrayRegion, jchar, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->SetCharArrayRegion(
+        static_cast<jcharArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
 #endif  // DRY_RUN
   }
 };
@@ -257,6 +376,32 @@ struct JniArrayHelper<jshort, 1> : public JniArrayHelperBase {
     const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
     jni::JniEnv::GetEnv()->ReleaseShortArrayElements(
         static_cast<jshortArray>(array), native_ptr, copy_back_mode);
+#endif  // DRY_RUN
+  }
+
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jshort* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("GetArrayRegion, jshort, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->GetShortArrayRegion(
+        static_cast<jshortArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jshort* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("SetArrayRegion, jshort, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->SetShortArrayRegion(
+        static_cast<jshortArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
 #endif  // DRY_RUN
   }
 };
@@ -301,6 +446,32 @@ struct JniArrayHelper<jint, 1> : public JniArrayHelperBase {
     const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
     jni::JniEnv::GetEnv()->ReleaseIntArrayElements(
         static_cast<jintArray>(array), native_ptr, copy_back_mode);
+#endif  // DRY_RUN
+  }
+
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jint* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("GetArrayRegion, jint, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->GetIntArrayRegion(
+        static_cast<jintArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jint* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("SetArrayRegion, jint, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->SetIntArrayRegion(
+        static_cast<jintArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
 #endif  // DRY_RUN
   }
 };
@@ -344,6 +515,32 @@ struct JniArrayHelper<jlong, 1> : public JniArrayHelperBase {
     const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
     jni::JniEnv::GetEnv()->ReleaseLongArrayElements(
         static_cast<jlongArray>(array), native_ptr, copy_back_mode);
+#endif  // DRY_RUN
+  }
+
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jlong* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("GetArrayRegion, jlong, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->GetLongArrayRegion(
+        static_cast<jlongArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jlong* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("SetArrayRegion, jlong, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->SetLongArrayRegion(
+        static_cast<jlongArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
 #endif  // DRY_RUN
   }
 };
@@ -386,6 +583,32 @@ struct JniArrayHelper<jfloat, 1> : public JniArrayHelperBase {
     jni::JniEnv::GetEnv()->ReleaseFloatArrayElements(
         static_cast<jfloatArray>(array), native_ptr, copy_back_mode);
   }
+
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jfloat* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("GetArrayRegion, jfloat, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->GetFloatArrayRegion(
+        static_cast<jfloatArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jfloat* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("SetArrayRegion, jfloat, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->SetFloatArrayRegion(
+        static_cast<jfloatArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
 };
 
 template <>
@@ -428,6 +651,32 @@ struct JniArrayHelper<jdouble, 1> : public JniArrayHelperBase {
     const jint copy_back_mode = copy_on_completion ? 0 : JNI_ABORT;
     jni::JniEnv::GetEnv()->ReleaseDoubleArrayElements(
         static_cast<jdoubleArray>(array), native_ptr, copy_back_mode);
+#endif  // DRY_RUN
+  }
+
+  static inline void GetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, jdouble* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("GetArrayRegion, jdouble, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->GetDoubleArrayRegion(
+        static_cast<jdoubleArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
+#endif  // DRY_RUN
+  }
+
+  static inline void SetArrayRegion(jarray array, std::size_t start,
+                                    std::size_t len, const jdouble* buffer) {
+    Trace(metaprogramming::LambdaToStr(STR("SetArrayRegion, jdouble, Rank 1")),
+          array, start, len, buffer);
+
+#ifdef DRY_RUN
+#else
+    jni::JniEnv::GetEnv()->SetDoubleArrayRegion(
+        static_cast<jdoubleArray>(array), static_cast<jsize>(start),
+        static_cast<jsize>(len), buffer);
 #endif  // DRY_RUN
   }
 };
@@ -17,6 +17,10 @@
 #ifndef JNI_BIND_JNI_HELPER_JNI_ENV_H_
 #define JNI_BIND_JNI_HELPER_JNI_ENV_H_
 
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+
 #include "jni_dep.h"
 
 namespace jni {
@@ -45,7 +49,39 @@ class ThreadGuard;
 // result in unnecessary and excessive writes.
 class JniEnv {
  public:
-  static JNIEnv* GetEnv() { return env_; }
+  static JNIEnv* GetEnv() {
+#ifndef NDEBUG
+    if (critical_region_depth_ != 0) {
+      FlagCallInCriticalRegion();
+    }
+#endif  // NDEBUG
+
+    return env_;
+  }
+
+  // JNI forbids any call other than further critical functions while a
+  // critical region is open on a thread (see `CriticalArrayView`). In debug
+  // builds, `GetEnv` counts calls that break this (only the first is
+  // reported).
+  static std::atomic<std::size_t>& CallsInCriticalRegion() {
+    static std::atomic<std::size_t> ret_val{0};
+    return ret_val;
+  }
+
+  // For the critical functions themselves, which are exempt from the above.
+  static JNIEnv* GetEnvForCriticalRegion() { return env_; }
+
+  static void EnterCriticalRegion() {
+#ifndef NDEBUG
+    ++critical_region_depth_;
+#endif  // NDEBUG
+  }
+
+  static void ExitCriticalRegion() {
+#ifndef NDEBUG
+    --critical_region_depth_;
+#endif  // NDEBUG
+  }
 
  protected:
   template <const auto& jvm_v_>
@@ -56,6 +92,17 @@ class JniEnv {
 
   // This will always be set when a new object is created (see above).
   static inline thread_local JNIEnv* env_;
+
+ private:
+  static void FlagCallInCriticalRegion() {
+    if (CallsInCriticalRegion().fetch_add(1, std::memory_order_relaxed) == 0) {
+      fprintf(stderr, "JNI Bind: JNI call made inside a critical region (see "
+                      "JniEnv::CallsInCriticalRegion for further calls).\n");
+    }
+  }
+
+  // Open critical regions on this thread (debug builds only).
+  static inline thread_local std::size_t critical_region_depth_ = 0;
 };
 
 }  // namespace jni
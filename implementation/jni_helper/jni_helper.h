@@ -33,12 +33,33 @@ class JniHelper {
   // Finds a class with "name".  Note, the classloader used is whatever is
   // present on the stack when this is called.  No caching is performed,
   // returned `jclass` is a local.
+  //
+  // If that fails and a fallback loader is set (see `JvmRef`), the class is
+  // loaded through it instead, and that outcome *is* cached by name (see
+  // `FindClassFallbackCache`). If the fallback also fails, null is returned
+  // with no exception pending (the `ClassNotFoundException` is cleared), and
+  // every later lookup of `name` returns null without retrying until the
+  // failure is forgotten with `FindClassFallbackCache::ClearTombstones` or
+  // `Clear`.
   static jclass FindClass(const char* name);
 
   // Returns a local ref jclass for the given jobject.
   // Note, if the object is polymorphic it may be a sub or superclass.
   static jclass GetObjectClass(jobject object);
 
+  // Returns true if `lhs` and `rhs` refer to the same Java object. A weak
+  // global whose referent has been collected is the same as null.
+  static bool IsSameObject(jobject lhs, jobject rhs);
+
+  // Returns true if `object` is an instance of `clazz` or one of its
+  // subclasses. A null `object` is an instance of every class.
+  static bool IsInstanceOf(jobject object, jclass clazz);
+
+  // Weak globals do not prevent `object` from being collected.
+  static jweak NewWeakGlobalRef(jobject object);
+
+  static void DeleteWeakGlobalRef(jweak object);
+
   // Gets a method for a signature (no caching is performed).
   static inline jmethodID GetMethodID(jclass clazz, const char* method_name,
                                       const char* method_signature);
@@ -60,6 +81,53 @@ class JniHelper {
   static const char* GetStringUTFChars(jstring str);
 
   static void ReleaseStringUTFChars(jstring str, const char* chars);
+
+  // Length of `str` in UTF-16 code units.
+  static jsize GetStringLength(jstring str);
+
+  // Length of `str` in bytes of modified UTF-8 (excluding a terminator).
+  static jsize GetStringUTFLength(jstring str);
+
+  // Copies `len` UTF-16 code units of `str` from `start` into `buf` as
+  // modified UTF-8, no pinning or release is required.
+  static void GetStringUTFRegion(jstring str, jsize start, jsize len,
+                                 char* buf);
+
+  // Returns true if an exception is pending, without creating a local.
+  static bool ExceptionCheck();
+
+  // Returns a local to the pending exception (or null if there is none).
+  static jthrowable ExceptionOccurred();
+
+  static void ExceptionClear();
+
+  // Throws `throwable` as is, preserving its type and stack trace.
+  static jint Throw(jthrowable throwable);
+
+  // Constructs and throws a new `clazz` with `message`.
+  static jint ThrowNew(jclass clazz, const char* message);
+
+  // Local frames bound the number of live local references, all references
+  // created within a frame are released when it is popped.
+  static jint PushLocalFrame(jint capacity);
+
+  static jobject PopLocalFrame(jobject result);
+
+  // Registers `size` native implementations for methods of `clazz`.
+  static jint RegisterNatives(jclass clazz, const JNINativeMethod* methods,
+                              jint size);
+
+  // Wraps `capacity` bytes at `address` in a local `java.nio.ByteBuffer`.
+  // The memory is not copied and must outlive every use of the buffer.
+  static jobject NewDirectByteBuffer(void* address, jlong capacity);
+
+  // Returns the memory behind a direct `java.nio.Buffer`, or null if `buffer`
+  // is not direct.
+  static void* GetDirectBufferAddress(jobject buffer);
+
+  // Returns the capacity of a direct `java.nio.Buffer`, or -1 if `buffer` is
+  // not direct.
+  static jlong GetDirectBufferCapacity(jobject buffer);
 };
 
 //==============================================================================
@@ -99,6 +167,45 @@ inline jclass JniHelper::GetObjectClass(jobject object) {
 #endif  // DRY_RUN
 }
 
+inline bool JniHelper::IsSameObject(jobject lhs, jobject rhs) {
+  Trace(metaprogramming::LambdaToStr(STR("IsSameObject")), lhs, rhs);
+
+#ifdef DRY_RUN
+  return lhs == rhs;
+#else
+  return jni::JniEnv::GetEnv()->IsSameObject(lhs, rhs) == JNI_TRUE;
+#endif  // DRY_RUN
+}
+
+inline bool JniHelper::IsInstanceOf(jobject object, jclass clazz) {
+  Trace(metaprogramming::LambdaToStr(STR("IsInstanceOf")), object, clazz);
+
+#ifdef DRY_RUN
+  return true;
+#else
+  return jni::JniEnv::GetEnv()->IsInstanceOf(object, clazz) == JNI_TRUE;
+#endif  // DRY_RUN
+}
+
+inline jweak JniHelper::NewWeakGlobalRef(jobject object) {
+  Trace(metaprogramming::LambdaToStr(STR("NewWeakGlobalRef")), object);
+
+#ifdef DRY_RUN
+  return Fake<jweak>();
+#else
+  return jni::JniEnv::GetEnv()->NewWeakGlobalRef(object);
+#endif  // DRY_RUN
+}
+
+inline void JniHelper::DeleteWeakGlobalRef(jweak object) {
+  Trace(metaprogramming::LambdaToStr(STR("DeleteWeakGlobalRef")), object);
+
+#ifdef DRY_RUN
+#else
+  jni::JniEnv::GetEnv()->DeleteWeakGlobalRef(object);
+#endif  // DRY_RUN
+}
+
 jmethodID JniHelper::GetMethodID(jclass clazz, const char* method_name,
                                  const char* method_signature) {
   Trace(metaprogramming::LambdaToStr(STR("GetMethodID")), clazz, method_name,
@@ -173,6 +280,150 @@ inline void JniHelper::ReleaseStringUTFChars(jstring str, const char* chars) {
 #endif  // DRY_RUN
 }
 
+inline jsize JniHelper::GetStringLength(jstring str) {
+  Trace(metaprogramming::LambdaToStr(STR("GetStringLength")), str);
+
+#ifdef DRY_RUN
+  return 0;
+#else
+  return jni::JniEnv::GetEnv()->GetStringLength(str);
+#endif  // DRY_RUN
+}
+
+inline jsize JniHelper::GetStringUTFLength(jstring str) {
+  Trace(metaprogramming::LambdaToStr(STR("GetStringUTFLength")), str);
+
+#ifdef DRY_RUN
+  return 0;
+#else
+  return jni::JniEnv::GetEnv()->GetStringUTFLength(str);
+#endif  // DRY_RUN
+}
+
+inline void JniHelper::GetStringUTFRegion(jstring str, jsize start, jsize len,
+                                          char* buf) {
+  Trace(metaprogramming::LambdaToStr(STR("GetStringUTFRegion")), str, start,
+        len, buf);
+
+#ifdef DRY_RUN
+#else
+  jni::JniEnv::GetEnv()->GetStringUTFRegion(str, start, len, buf);
+#endif  // DRY_RUN
+}
+
+inline bool JniHelper::ExceptionCheck() {
+  Trace(metaprogramming::LambdaToStr(STR("ExceptionCheck")));
+
+#ifdef DRY_RUN
+  return false;
+#else
+  return jni::JniEnv::GetEnv()->ExceptionCheck() == JNI_TRUE;
+#endif  // DRY_RUN
+}
+
+inline jthrowable JniHelper::ExceptionOccurred() {
+  Trace(metaprogramming::LambdaToStr(STR("ExceptionOccurred")));
+
+#ifdef DRY_RUN
+  return nullptr;
+#else
+  return jni::JniEnv::GetEnv()->ExceptionOccurred();
+#endif  // DRY_RUN
+}
+
+inline void JniHelper::ExceptionClear() {
+  Trace(metaprogramming::LambdaToStr(STR("ExceptionClear")));
+
+#ifdef DRY_RUN
+#else
+  jni::JniEnv::GetEnv()->ExceptionClear();
+#endif  // DRY_RUN
+}
+
+inline jint JniHelper::Throw(jthrowable throwable) {
+  Trace(metaprogramming::LambdaToStr(STR("Throw")), throwable);
+
+#ifdef DRY_RUN
+  return JNI_OK;
+#else
+  return jni::JniEnv::GetEnv()->Throw(throwable);
+#endif  // DRY_RUN
+}
+
+inline jint JniHelper::ThrowNew(jclass clazz, const char* message) {
+  Trace(metaprogramming::LambdaToStr(STR("ThrowNew")), clazz, message);
+
+#ifdef DRY_RUN
+  return JNI_OK;
+#else
+  return jni::JniEnv::GetEnv()->ThrowNew(clazz, message);
+#endif  // DRY_RUN
+}
+
+inline jint JniHelper::PushLocalFrame(jint capacity) {
+  Trace(metaprogramming::LambdaToStr(STR("PushLocalFrame")), capacity);
+
+#ifdef DRY_RUN
+  return JNI_OK;
+#else
+  return jni::JniEnv::GetEnv()->PushLocalFrame(capacity);
+#endif  // DRY_RUN
+}
+
+inline jobject JniHelper::PopLocalFrame(jobject result) {
+  Trace(metaprogramming::LambdaToStr(STR("PopLocalFrame")), result);
+
+#ifdef DRY_RUN
+  return result;
+#else
+  return jni::JniEnv::GetEnv()->PopLocalFrame(result);
+#endif  // DRY_RUN
+}
+
+inline jint JniHelper::RegisterNatives(jclass clazz,
+                                       const JNINativeMethod* methods,
+                                       jint size) {
+  Trace(metaprogramming::LambdaToStr(STR("RegisterNatives")), clazz, methods,
+        size);
+
+#ifdef DRY_RUN
+  return JNI_OK;
+#else
+  return jni::JniEnv::GetEnv()->RegisterNatives(clazz, methods, size);
+#endif  // DRY_RUN
+}
+
+inline jobject JniHelper::NewDirectByteBuffer(void* address, jlong capacity) {
+  Trace(metaprogramming::LambdaToStr(STR("NewDirectByteBuffer")), address,
+        capacity);
+
+#ifdef DRY_RUN
+  return Fake<jobject>();
+#else
+  return jni::JniEnv::GetEnv()->NewDirectByteBuffer(address, capacity);
+#endif  // DRY_RUN
+}
+
+inline void* JniHelper::GetDirectBufferAddress(jobject buffer) {
+  Trace(metaprogramming::LambdaToStr(STR("GetDirectBufferAddress")), buffer);
+
+#ifdef DRY_RUN
+  return nullptr;
+#else
+  return jni::JniEnv::GetEnv()->GetDirectBufferAddress(buffer);
+#endif  // DRY_RUN
+}
+
+inline jlong JniHelper::GetDirectBufferCapacity(jobject buffer) {
+  Trace(metaprogramming::LambdaToStr(STR("GetDirectBufferCapacity")), buffer);
+
+#ifdef DRY_RUN
+  return Fake<jlong>();
+#else
+  return jni::JniEnv::GetEnv()->GetDirectBufferCapacity(buffer);
+#endif  // DRY_RUN
+}
+
 }  // namespace jni
 
 #endif  // JNI_BIND_JNI_HELPER_JNI_HELPER_H_
@@ -55,4 +55,43 @@ TEST_F(JniTest, JniHelper_CallsReleaseStringUTFChars) {
   JniHelper::ReleaseStringUTFChars(Fake<jstring>(), fake_pinned_chars);
 }
 
+TEST_F(JniTest, JniHelper_CallsPushAndPopLocalFrame) {
+  InSequence seq;
+  EXPECT_CALL(*env_, PushLocalFrame(16)).WillOnce(testing::Return(JNI_OK));
+  EXPECT_CALL(*env_, PopLocalFrame(nullptr)).WillOnce(testing::Return(nullptr));
+
+  EXPECT_EQ(JniHelper::PushLocalFrame(16), JNI_OK);
+  EXPECT_EQ(JniHelper::PopLocalFrame(nullptr), nullptr);
+}
+
+TEST_F(JniTest, JniHelper_CallsExceptionFunctions) {
+  InSequence seq;
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_TRUE));
+  EXPECT_CALL(*env_, ExceptionOccurred).WillOnce(testing::Return(nullptr));
+  EXPECT_CALL(*env_, ExceptionClear);
+
+  EXPECT_TRUE(JniHelper::ExceptionCheck());
+  EXPECT_EQ(JniHelper::ExceptionOccurred(), nullptr);
+  JniHelper::ExceptionClear();
+}
+
+TEST_F(JniTest, JniHelper_CallsNewDirectByteBuffer) {
+  char bytes[8];
+  EXPECT_CALL(*env_, NewDirectByteBuffer(bytes, 8))
+      .WillOnce(testing::Return(Fake<jobject>()));
+
+  EXPECT_EQ(JniHelper::NewDirectByteBuffer(bytes, 8), Fake<jobject>());
+}
+
+TEST_F(JniTest, JniHelper_CallsGetDirectBufferAddressAndCapacity) {
+  char bytes[8];
+  EXPECT_CALL(*env_, GetDirectBufferAddress(Fake<jobject>()))
+      .WillOnce(testing::Return(bytes));
+  EXPECT_CALL(*env_, GetDirectBufferCapacity(Fake<jobject>()))
+      .WillOnce(testing::Return(8));
+
+  EXPECT_EQ(JniHelper::GetDirectBufferAddress(Fake<jobject>()), bytes);
+  EXPECT_EQ(JniHelper::GetDirectBufferCapacity(Fake<jobject>()), 8);
+}
+
 }  // namespace
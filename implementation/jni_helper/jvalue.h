@@ -0,0 +1,63 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef JNI_BIND_IMPLEMENTATION_JNI_HELPER_JVALUE_H_
+#define JNI_BIND_IMPLEMENTATION_JNI_HELPER_JVALUE_H_
+
+#include "jni_dep.h"
+
+namespace jni {
+
+// Packs `val` into the `jvalue` member selected by `kSignatureChar`, the
+// leading character of the declared parameter's JNI signature (e.g. 'I' for
+// jint, 'L' or '[' for objects and arrays).
+//
+// This is the same selection the JVM makes when unpacking a `va_list` for the
+// `Call<Type>Method` family, but here it is resolved at compile time so that
+// the `Call<Type>MethodA` family can be used instead.
+template <char kSignatureChar, typename T>
+inline jvalue ToJvalue(const T& val) {
+  jvalue ret{};
+
+  if constexpr (kSignatureChar == 'Z') {
+    ret.z = static_cast<jboolean>(val);
+  } else if constexpr (kSignatureChar == 'B') {
+    ret.b = static_cast<jbyte>(val);
+  } else if constexpr (kSignatureChar == 'C') {
+    ret.c = static_cast<jchar>(val);
+  } else if constexpr (kSignatureChar == 'S') {
+    ret.s = static_cast<jshort>(val);
+  } else if constexpr (kSignatureChar == 'I') {
+    ret.i = static_cast<jint>(val);
+  } else if constexpr (kSignatureChar == 'J') {
+    ret.j = static_cast<jlong>(val);
+  } else if constexpr (kSignatureChar == 'F') {
+    ret.f = static_cast<jfloat>(val);
+  } else if constexpr (kSignatureChar == 'D') {
+    ret.d = static_cast<jdouble>(val);
+  } else {
+    static_assert(kSignatureChar == 'L' || kSignatureChar == '[',
+                  "Unrecognised JNI signature character.");
+    ret.l = val;
+  }
+
+  return ret;
+}
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_JNI_HELPER_JVALUE_H_
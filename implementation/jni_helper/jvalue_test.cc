@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "jvalue.h"
+
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_dep.h"
+
+namespace {
+
+using ::jni::Fake;
+using ::jni::ToJvalue;
+
+TEST(Jvalue, PacksPrimitivesIntoDeclaredMember) {
+  EXPECT_EQ(ToJvalue<'Z'>(true).z, JNI_TRUE);
+  EXPECT_EQ(ToJvalue<'B'>(jbyte{-1}).b, jbyte{-1});
+  EXPECT_EQ(ToJvalue<'C'>('a').c, jchar{'a'});
+  EXPECT_EQ(ToJvalue<'S'>(jshort{12}).s, jshort{12});
+  EXPECT_EQ(ToJvalue<'I'>(123).i, 123);
+  EXPECT_EQ(ToJvalue<'J'>(jlong{1} << 40).j, jlong{1} << 40);
+  EXPECT_EQ(ToJvalue<'F'>(1.5f).f, 1.5f);
+  EXPECT_EQ(ToJvalue<'D'>(2.5).d, 2.5);
+}
+
+TEST(Jvalue, WidensToDeclaredMember) {
+  // e.g. an int literal passed for a declared jlong.
+  EXPECT_EQ(ToJvalue<'J'>(-1).j, jlong{-1});
+  EXPECT_EQ(ToJvalue<'D'>(1.5f).d, 1.5);
+}
+
+TEST(Jvalue, PacksObjectsAndArrays) {
+  EXPECT_EQ(ToJvalue<'L'>(Fake<jobject>()).l, Fake<jobject>());
+  EXPECT_EQ(ToJvalue<'L'>(Fake<jstring>()).l, Fake<jstring>());
+  EXPECT_EQ(ToJvalue<'['>(Fake<jintArray>()).l, Fake<jintArray>());
+  EXPECT_EQ(ToJvalue<'L'>(nullptr).l, nullptr);
+}
+
+}  // namespace
@@ -39,6 +39,18 @@ struct LifecycleHelper<jobject, LifecycleType::LOCAL>
     return Fake<jobject>();
 #else
     return JniEnv::GetEnv()->NewObject(clazz, ctor_method, ctor_args...);
+#endif  // DRY_RUN
+  }
+
+  static inline jobject ConstructA(jclass clazz, jmethodID ctor_method,
+                                   const jvalue* ctor_args) {
+    Trace(metaprogramming::LambdaToStr(STR("NewObjectA")), clazz, ctor_method,
+          ctor_args);
+
+#ifdef DRY_RUN
+    return Fake<jobject>();
+#else
+    return JniEnv::GetEnv()->NewObjectA(clazz, ctor_method, ctor_args);
 #endif  // DRY_RUN
   }
 };
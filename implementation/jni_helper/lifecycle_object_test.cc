@@ -49,6 +49,15 @@ TEST_F(JniTest, Lifecycle_jobject_Local_CallsNewObjectV) {
       Fake<jclass>(), Fake<jmethodID>(), 1, 2, 3);
 }
 
+TEST_F(JniTest, Lifecycle_jobject_Local_CallsNewObjectA) {
+  const jvalue args[3]{{.i = 1}, {.i = 2}, {.i = 3}};
+
+  EXPECT_CALL(*env_, NewObjectA(Eq(Fake<jclass>()), Eq(Fake<jmethodID>()),
+                                Eq(args)));
+  LifecycleHelper<jobject, LifecycleType::LOCAL>::ConstructA(
+      Fake<jclass>(), Fake<jmethodID>(), args);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Global jobject.
 ////////////////////////////////////////////////////////////////////////////////
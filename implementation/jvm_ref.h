@@ -21,15 +21,19 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 #include "class_defs/android/activity_thread.h"
 #include "class_defs/android/application.h"
 #include "class_defs/java_lang_classes.h"
+#include "implementation/class_keyed_map.h"
 #include "implementation/class_ref.h"
 #include "implementation/configuration.h"
 #include "implementation/default_class_loader.h"
 #include "implementation/field_ref.h"
+#include "implementation/find_class_fallback_cache.h"
 #include "implementation/forward_declarations.h"
 #include "implementation/global_class_loader.h"
 #include "implementation/jni_helper/invoke_static.h"  // NOLINT
@@ -42,6 +46,7 @@
 #include "implementation/jvm_ref_base.h"
 #include "implementation/local_object.h"
 #include "implementation/no_class_specified.h"
+#include "implementation/prewarm.h"
 #include "implementation/promotion_mechanics_tags.h"
 #include "implementation/ref_storage.h"
 #include "implementation/static_ref.h"
@@ -117,6 +122,8 @@ class JvmRef : public JvmRefBase {
           std::make_index_sequence<
               std::tuple_size_v<decltype(jvm_v_.class_loaders_)>>());
 
+      // Global references to classes must be released, so each is reset.
+      std::lock_guard<std::mutex> lock_guard{DefaultRefsLock<jclass>()};
       auto& default_loaded_class_list = DefaultRefs<jclass>();
       for (metaprogramming::DoubleLockedValue<jclass>* maybe_loaded_class_id :
            default_loaded_class_list) {
@@ -125,26 +132,32 @@ class JvmRef : public JvmRefBase {
         });
       }
       default_loaded_class_list.clear();
+
+      // IDs keyed by the (now released) classes of non-default loaders.
+      {
+        std::lock_guard<std::mutex> maps_lock_guard{ClassKeyedMapsLock()};
+        for (ClassKeyedMapBase* class_keyed_map : ClassKeyedMaps()) {
+          class_keyed_map->Clear();
+        }
+        ClassKeyedMaps().clear();
+      }
+
+      FindClassFallbackCache::Clear();
     }
 
+    // Methods and fields do not need to be released, just forgotten, so rather
+    // than resetting each, they are invalidated together and lazily
+    // re-resolved on next use.
     if (kConfiguration.release_method_ids_on_teardown_) {
-      // Methods do not need to be released, just forgotten.
-      auto& default_loaded_method_ref_list = DefaultRefs<jmethodID>();
-      for (metaprogramming::DoubleLockedValue<jmethodID>* cached_method_id :
-           default_loaded_method_ref_list) {
-        cached_method_id->Reset();
-      }
-      default_loaded_method_ref_list.clear();
+      metaprogramming::DoubleLockedValue<jmethodID>::SetLiveGeneration(
+          IdGeneration<jmethodID>().fetch_add(1, std::memory_order_relaxed) +
+          1);
     }
 
     if (kConfiguration.release_field_ids_on_teardown_) {
-      // Fields do not need to be released, just forgotten.
-      auto& default_loaded_field_ref_list = GetDefaultLoadedFieldList();
-      for (metaprogramming::DoubleLockedValue<jfieldID>* cached_field_id :
-           default_loaded_field_ref_list) {
-        cached_field_id->Reset();
-      }
-      default_loaded_field_ref_list.clear();
+      metaprogramming::DoubleLockedValue<jfieldID>::SetLiveGeneration(
+          IdGeneration<jfieldID>().fetch_add(1, std::memory_order_relaxed) +
+          1);
     }
   }
 
@@ -156,6 +169,20 @@ class JvmRef : public JvmRefBase {
   // If a JNIEnv does not exist, this will DetachCurrentThread when done.
   [[nodiscard]] ThreadGuard BuildThreadGuard() const { return {}; }
 
+  // Resolves every class, method and field ID of `class_vs` up front, see
+  // `jni::Prewarm`.
+  template <const auto&... class_vs>
+  std::vector<PrewarmFailure> Prewarm(std::size_t num_threads = 1) const {
+    return jni::Prewarm<class_vs...>(num_threads);
+  }
+
+  // Resolves the working set recorded in the `StartupProfile` at `path`, see
+  // `jni::ReplayStartupProfile`.
+  std::vector<PrewarmFailure> ReplayStartupProfile(
+      const char* path, std::size_t num_threads = 1) const {
+    return jni::ReplayStartupProfileFromFile(path, num_threads);
+  }
+
   // Sets a "fallback" loader for use when default Jvm classes fail to load.
   // This is useful for first use of classes on secondary threads where the
   // jclass is not yet cached and the classloader isn't available directly.
@@ -166,6 +193,9 @@ class JvmRef : public JvmRefBase {
             AdoptGlobal{}, loader.Release()));
 
     FallbackLoader() = static_cast<jobject>(*fallback_loader_);
+
+    // Outcomes from a previous loader no longer apply.
+    FindClassFallbackCache::Clear();
   }
 
   // Sets a "fallback" loader for use when default Jvm classes fail to load.
@@ -29,6 +29,7 @@ using ::jni::test::AsGlobal;
 using ::jni::test::JniTest;
 using ::jni::test::JniTestWithNoDefaultJvmRef;
 using ::jni::test::kDefaultConfiguration;
+using ::testing::_;
 using ::testing::AnyNumber;
 using ::testing::Return;
 
@@ -193,4 +194,65 @@ TEST_F(JniTestWithNoDefaultJvmRef, JvmRefsTeardownIfConfigurationIsTrue) {
   }
 }
 
+TEST_F(JniTestWithNoDefaultJvmRef, JvmRefsInvalidateMethodAndFieldIds) {
+  EXPECT_CALL(*env_, FindClass(testing::StrEq("android/app/ActivityThread")))
+      .Times(AnyNumber())
+      .WillRepeatedly(Return(nullptr));
+  EXPECT_CALL(*env_, ExceptionClear()).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(testing::StrEq("com/google/UniqueClass3")))
+      .WillRepeatedly(Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+
+  // Re-resolved lazily once per JvmRef.
+  EXPECT_CALL(*env_, GetMethodID(_, testing::StrEq("Foo"), _)).Times(2);
+  EXPECT_CALL(*env_, GetFieldID(_, testing::StrEq("field"), _)).Times(2);
+
+  static constexpr Class kClass{
+      "com/google/UniqueClass3",
+      jni::Method{"Foo", jni::Return<void>{}, jni::Params<>{}},
+      jni::Field{"field", jint{}},
+  };
+
+  for (int i = 0; i < 2; ++i) {
+    JvmRef<jni::kDefaultJvm> jvm_ref{jvm_.get(), kDefaultConfiguration};
+    LocalObject<kClass> obj{Fake<jobject>()};
+    obj.Call<"Foo">();
+    obj.Call<"Foo">();
+    obj.Access<"field">().Get();
+    obj.Access<"field">().Get();
+  }
+}
+
+TEST_F(JniTestWithNoDefaultJvmRef,
+       JvmRefsKeepMethodAndFieldIdsIfConfigurationIsFalse) {
+  EXPECT_CALL(*env_, FindClass(testing::StrEq("android/app/ActivityThread")))
+      .Times(AnyNumber())
+      .WillRepeatedly(Return(nullptr));
+  EXPECT_CALL(*env_, ExceptionClear()).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(testing::StrEq("com/google/UniqueClass4")))
+      .WillRepeatedly(Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+
+  EXPECT_CALL(*env_, GetMethodID(_, testing::StrEq("Foo"), _)).Times(1);
+  EXPECT_CALL(*env_, GetFieldID(_, testing::StrEq("field"), _)).Times(1);
+
+  static constexpr jni::Configuration kNoTeardownConfig{
+      .release_class_ids_on_teardown_ = false,
+      .release_method_ids_on_teardown_ = false,
+      .release_field_ids_on_teardown_ = false,
+  };
+  static constexpr Class kClass{
+      "com/google/UniqueClass4",
+      jni::Method{"Foo", jni::Return<void>{}, jni::Params<>{}},
+      jni::Field{"field", jint{}},
+  };
+
+  for (int i = 0; i < 2; ++i) {
+    JvmRef<jni::kDefaultJvm> jvm_ref{jvm_.get(), kNoTeardownConfig};
+    LocalObject<kClass> obj{Fake<jobject>()};
+    obj.Call<"Foo">();
+    obj.Access<"field">().Get();
+  }
+}
+
 }  // namespace
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <array>
 #include <utility>
 
 #include <gmock/gmock.h>
@@ -152,4 +153,73 @@ TEST_F(JniTest, ConstructsFromRValue) {
   LocalArray<jint> arr2{std::move(arr)};
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Region Tests.
+////////////////////////////////////////////////////////////////////////////////
+TEST_F(JniTest, CopyToOnlyCopiesTheRequestedRegion) {
+  std::array<jint, 4> out{};
+  // Only read to check the bounds in debug builds.
+  EXPECT_CALL(*env_, GetArrayLength).WillRepeatedly(Return(68));
+  EXPECT_CALL(*env_, GetIntArrayElements).Times(0);
+  EXPECT_CALL(*env_,
+              GetIntArrayRegion(Fake<jintArray>(), 64, 4, out.data()));
+
+  LocalArray<jint> arr{AdoptLocal{}, Fake<jintArray>()};
+  arr.CopyTo(64, out);
+}
+
+TEST_F(JniTest, CopyFromOnlyCopiesTheGivenRegion) {
+  const std::array<jdouble, 3> in{1., 2., 3.};
+  EXPECT_CALL(*env_, GetArrayLength).WillRepeatedly(Return(13));
+  EXPECT_CALL(*env_, ReleaseDoubleArrayElements).Times(0);
+  EXPECT_CALL(*env_,
+              SetDoubleArrayRegion(Fake<jdoubleArray>(), 10, 3, in.data()));
+
+  LocalArray<jdouble> arr{AdoptLocal{}, Fake<jdoubleArray>()};
+  arr.CopyFrom(10, in);
+}
+
+TEST_F(JniTest, RegionsAreSupportedForAllPrimitiveTypes) {
+  std::array<jboolean, 1> booleans{};
+  std::array<jbyte, 1> bytes{};
+  std::array<jchar, 1> chars{};
+  std::array<jshort, 1> shorts{};
+  std::array<jlong, 1> longs{};
+  std::array<jfloat, 1> floats{};
+
+  EXPECT_CALL(*env_, GetArrayLength).WillRepeatedly(Return(1));
+  EXPECT_CALL(*env_, GetBooleanArrayRegion(_, 0, 1, booleans.data()));
+  EXPECT_CALL(*env_, SetBooleanArrayRegion(_, 0, 1, booleans.data()));
+  EXPECT_CALL(*env_, GetByteArrayRegion(_, 0, 1, bytes.data()));
+  EXPECT_CALL(*env_, SetByteArrayRegion(_, 0, 1, bytes.data()));
+  EXPECT_CALL(*env_, GetCharArrayRegion(_, 0, 1, chars.data()));
+  EXPECT_CALL(*env_, SetCharArrayRegion(_, 0, 1, chars.data()));
+  EXPECT_CALL(*env_, GetShortArrayRegion(_, 0, 1, shorts.data()));
+  EXPECT_CALL(*env_, SetShortArrayRegion(_, 0, 1, shorts.data()));
+  EXPECT_CALL(*env_, GetLongArrayRegion(_, 0, 1, longs.data()));
+  EXPECT_CALL(*env_, SetLongArrayRegion(_, 0, 1, longs.data()));
+  EXPECT_CALL(*env_, GetFloatArrayRegion(_, 0, 1, floats.data()));
+  EXPECT_CALL(*env_, SetFloatArrayRegion(_, 0, 1, floats.data()));
+
+  LocalArray<jboolean> boolean_array{AdoptLocal{}, Fake<jbooleanArray>()};
+  LocalArray<jbyte> byte_array{AdoptLocal{}, Fake<jbyteArray>()};
+  LocalArray<jchar> char_array{AdoptLocal{}, Fake<jcharArray>()};
+  LocalArray<jshort> short_array{AdoptLocal{}, Fake<jshortArray>()};
+  LocalArray<jlong> long_array{AdoptLocal{}, Fake<jlongArray>()};
+  LocalArray<jfloat> float_array{AdoptLocal{}, Fake<jfloatArray>()};
+
+  boolean_array.CopyTo(0, booleans);
+  boolean_array.CopyFrom(0, booleans);
+  byte_array.CopyTo(0, bytes);
+  byte_array.CopyFrom(0, bytes);
+  char_array.CopyTo(0, chars);
+  char_array.CopyFrom(0, chars);
+  short_array.CopyTo(0, shorts);
+  short_array.CopyFrom(0, shorts);
+  long_array.CopyTo(0, longs);
+  long_array.CopyFrom(0, longs);
+  float_array.CopyTo(0, floats);
+  float_array.CopyFrom(0, floats);
+}
+
 }  // namespace
@@ -23,7 +23,7 @@
 #include "implementation/class_ref.h"
 #include "implementation/default_class_loader.h"
 #include "implementation/forward_declarations.h"
-#include "implementation/jni_helper/jni_env.h"
+#include "implementation/jni_helper/jni_helper.h"
 #include "implementation/jni_type.h"
 #include "implementation/jvm.h"
 #include "implementation/local_object.h"
@@ -48,11 +48,12 @@ class LocalException
   LocalException(LocalObject<class_v, class_loader_v, jvm_v>&& obj)
       : Base(AdoptLocal{}, obj.Release()) {}
 
+  LocalException(LocalException&& rhs) : Base(AdoptLocal{}, rhs.Release()) {}
+
+  // Throws this exception object itself, so its type, message, cause and
+  // stack trace are preserved.
   void Throw() {
-    LocalString message = (*this)("getMessage");
-    ::jni::JniEnv::GetEnv()->ThrowNew(
-        ::jni::ClassRef<JniT>::GetAndMaybeLoadClassRef(nullptr),
-        message.PinAsStr().ToString().c_str());
+    JniHelper::Throw(static_cast<jthrowable>(RefBase<jobject>::object_ref_));
   }
 };
 
@@ -85,6 +86,21 @@ template <const auto& class_v_ = kJavaLangException,
           const auto& jvm_v_ = kDefaultJvm>
 LocalException(jobject) -> LocalException<class_v_, class_loader_v_, jvm_v_>;
 
+// Constructs and throws a new `class_v` with `message` (which may be null).
+// The jclass comes from the `ClassRef` cache, so unlike building and then
+// throwing a `LocalException`, no constructor lookup or string is required.
+//
+//   jni::ThrowNew<kIllegalStateException>("Not initialised.");
+template <const auto& class_v = kJavaLangException,
+          const auto& class_loader_v = kDefaultClassLoader,
+          const auto& jvm_v = kDefaultJvm>
+jint ThrowNew(const char* message) {
+  return JniHelper::ThrowNew(
+      ClassRef_t<JniT<jobject, class_v, class_loader_v, jvm_v>>::
+          GetAndMaybeLoadClassRef(nullptr),
+      message);
+}
+
 }  // namespace jni
 
 #endif  // JNI_BIND_LOCAL_EXCEPTION_H_
@@ -26,6 +26,7 @@
 
 namespace {
 
+using ::jni::AdoptLocal;
 using ::jni::ClassRef;
 using ::jni::Fake;
 using ::jni::JniT;
@@ -49,67 +50,49 @@ static constexpr jni::Class kCustomException{
     jni::Method{"getMessage", jni::Return<jstring>{}, jni::Params<>{}},
 };
 
-TEST_F(JniTest, LocalException_ThrowCallsThrowNewWithCorrectMessage) {
-  // Allow NewLocalRef/DeleteLocalRef for object creation/destruction
-  EXPECT_CALL(*env_, NewLocalRef).Times(testing::AnyNumber());
+TEST_F(JniTest, LocalException_ThrowThrowsTheExistingObject) {
+  EXPECT_CALL(*env_, NewLocalRef).WillOnce(testing::Return(Fake<jobject>(2)));
   EXPECT_CALL(*env_, DeleteLocalRef).Times(testing::AnyNumber());
 
-  // Setup mock for getMessage
-  EXPECT_CALL(
-      *env_, GetMethodID(_, StrEq("getMessage"), StrEq("()Ljava/lang/String;")))
-      .WillOnce(testing::Return(Fake<jmethodID>(1)));
-
-  jstring fake_message = Fake<jstring>(123);
-  EXPECT_CALL(*env_, CallObjectMethodV(_, Fake<jmethodID>(1), _))
-      .WillOnce(testing::Return(fake_message));
-
-  // Setup mock for GetStringUTFChars (Pin)
-  const char* kErrorMessage = "The Error Message";
-  EXPECT_CALL(*env_, GetStringUTFChars(fake_message, _))
-      .WillOnce(testing::Return(kErrorMessage));
-
-  EXPECT_CALL(*env_, ReleaseStringUTFChars(fake_message, kErrorMessage));
-
-  // Setup mock for ThrowNew
-  EXPECT_CALL(*env_, ThrowNew(_, StrEq(kErrorMessage)))
+  EXPECT_CALL(*env_, GetMethodID).Times(0);
+  EXPECT_CALL(*env_, GetStringUTFChars).Times(0);
+  EXPECT_CALL(*env_, ThrowNew).Times(0);
+  EXPECT_CALL(*env_, Throw(static_cast<jthrowable>(Fake<jobject>(2))))
       .WillOnce(testing::Return(0));
 
   LocalException exception{Fake<jobject>()};
   exception.Throw();
 }
 
-TEST_F(JniTest, LocalCustomException_ThrowCallsThrowNewWithCorrectMessage) {
-  // Allow NewLocalRef/DeleteLocalRef for object creation/destruction
+TEST_F(JniTest, LocalCustomException_ThrowThrowsTheExistingObject) {
   EXPECT_CALL(*env_, NewLocalRef).Times(testing::AnyNumber());
   EXPECT_CALL(*env_, DeleteLocalRef).Times(testing::AnyNumber());
 
-  // Setup mock for getMessage
-  EXPECT_CALL(
-      *env_, GetMethodID(_, StrEq("getMessage"), StrEq("()Ljava/lang/String;")))
-      .WillOnce(testing::Return(Fake<jmethodID>(1)));
-
-  jstring fake_message = Fake<jstring>(123);
-  EXPECT_CALL(*env_, CallObjectMethodV(_, Fake<jmethodID>(1), _))
-      .WillOnce(testing::Return(fake_message));
+  EXPECT_CALL(*env_, ThrowNew).Times(0);
+  EXPECT_CALL(*env_, Throw(static_cast<jthrowable>(Fake<jobject>())))
+      .WillOnce(testing::Return(0));
 
-  // Setup mock for GetStringUTFChars (Pin)
-  const char* kErrorMessage = "Custom Error Message";
-  EXPECT_CALL(*env_, GetStringUTFChars(fake_message, _))
-      .WillOnce(testing::Return(kErrorMessage));
+  LocalException<kCustomException> exception{AdoptLocal{}, Fake<jobject>()};
+  exception.Throw();
+}
 
-  EXPECT_CALL(*env_, ReleaseStringUTFChars(fake_message, kErrorMessage));
+TEST_F(JniTest, ThrowNew_UsesCachedClassAndMessage) {
+  const char* kErrorMessage = "The Error Message";
 
-  // Setup mock for ThrowNew
+  EXPECT_CALL(*env_, FindClass(StrEq("com/jnibind/test/CustomException")))
+      .Times(1);
+  EXPECT_CALL(*env_, GetMethodID).Times(0);
+  EXPECT_CALL(*env_, NewStringUTF).Times(0);
   EXPECT_CALL(
       *env_,
       ThrowNew(
           ClassRef<JniT<jobject, kCustomException>>::GetAndMaybeLoadClassRef(
               nullptr),
           StrEq(kErrorMessage)))
-      .WillOnce(testing::Return(0));
+      .Times(2);
 
-  LocalException<kCustomException> exception{Fake<jobject>()};
-  exception.Throw();
+  jni::ThrowNew<kCustomException>(kErrorMessage);
+  jni::ThrowNew<kCustomException>(kErrorMessage);
 }
 
 TEST_F(JniTest, StaticMethodReturningLocalObjectAssignedToLocalException) {
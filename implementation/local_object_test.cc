@@ -33,6 +33,7 @@ using ::jni::LocalObject;
 using ::jni::Method;
 using ::jni::NewRef;
 using ::jni::Params;
+using ::jni::test::AsGlobal;
 using ::jni::test::AsNewLocalReference;
 using ::jni::test::JniTest;
 using ::testing::_;
@@ -131,6 +132,33 @@ TEST_F(JniTest, LocalObject_ObjectReturnsInstanceMethods) {
       12345, 12345.f, 12345, 12345.f, jdouble{12345});
 }
 
+TEST_F(JniTest, LocalObject_CallNonvirtualUsesDeclaredClass) {
+  static constexpr Class kClass{
+      "com/google/FinalClass",
+      Method{"Foo", jni::Return<jint>{}, Params<jint>{}},
+      Method{"Bar", jni::Return<void>{}, Params<>{}},
+      Method{"Baz", jni::Return{jni::Self{}}, Params<>{}},
+  };
+
+  const jobject local = AsNewLocalReference(Fake<jobject>());
+  const jclass clazz = AsGlobal(Fake<jclass>());
+
+  EXPECT_CALL(*env_, CallNonvirtualIntMethodV(local, clazz, _, _))
+      .WillOnce(testing::Return(123));
+  EXPECT_CALL(*env_, CallNonvirtualVoidMethodV(local, clazz, _, _));
+  EXPECT_CALL(*env_, CallNonvirtualObjectMethodV(local, clazz, _, _))
+      .WillOnce(testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, CallIntMethodV).Times(0);
+  EXPECT_CALL(*env_, CallVoidMethodV).Times(0);
+  EXPECT_CALL(*env_, CallObjectMethodV).Times(0);
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  EXPECT_EQ(obj.CallNonvirtual<"Foo">(1), 123);
+  obj.CallNonvirtual<"Bar">();
+  LocalObject<kClass> self{obj.CallNonvirtual<"Baz">()};
+  EXPECT_EQ(static_cast<jobject>(self), Fake<jobject>(2));
+}
+
 TEST_F(JniTest, LocalObject_CallsDeleteOnceAfterAMoveConstruction) {
   EXPECT_CALL(*env_, NewLocalRef).Times(1);
   EXPECT_CALL(*env_, DeleteLocalRef(AsNewLocalReference(Fake<jobject>())))
@@ -19,9 +19,12 @@
 
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
+#include <string>
+
 #include "class_defs/java_lang_classes.h"
 #include "implementation/forward_declarations.h"
 #include "implementation/jni_helper/lifecycle.h"
+#include "implementation/jni_helper/lifecycle_string.h"
 #include "implementation/jni_type.h"
 #include "implementation/local_object.h"
 #include "implementation/promotion_mechanics.h"
@@ -62,6 +65,25 @@ class LocalString : public LocalStringImpl {
   // Returns a UtfString which performs an expensive copy to std::string
   // and releases the pinned characters.
   UtfString PinAsStr() { return UtfString{RefBase<jstring>::object_ref_}; }
+
+  // Returns a copy of the contents as an std::string (see `CopyToStdString`).
+  std::string AsStdString() const& {
+    return CopyToStdString(RefBase<jstring>::object_ref_);
+  }
+
+  // As above, but the local reference is deleted as soon as it has been
+  // copied rather than at the end of the full expression, e.g.
+  // `std::string name = obj.Call<"getName">().AsStdString();`.
+  std::string AsStdString() && {
+    jstring java_string = RefBase<jstring>::Release();
+    std::string ret = CopyToStdString(java_string);
+
+    if (java_string) {
+      LifecycleHelper<jstring, LifecycleType::LOCAL>::Delete(java_string);
+    }
+
+    return ret;
+  }
 };
 
 }  // namespace jni
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_METHOD_ANCESTRY_H_
+#define JNI_BIND_IMPLEMENTATION_METHOD_ANCESTRY_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/id.h"
+#include "implementation/id_type.h"
+#include "implementation/no_class_specified.h"
+#include "implementation/no_idx.h"
+#include "implementation/selector_static_info.h"
+#include "metaprogramming/modified_max.h"
+
+namespace jni {
+
+// Index of the method named `name` in the methods declared directly on
+// `JniT`'s class, or `kNegativeOne` if there is none.
+template <typename JniT, std::size_t... Is>
+constexpr std::size_t MethodIdxOf(std::string_view name,
+                                  std::index_sequence<Is...>) {
+  return metaprogramming::ModifiedMax(
+      {(std::get<Is>(JniT::stripped_class_v.methods_).name_ == name
+            ? std::size_t{Is}
+            : metaprogramming::kNegativeOne)...,
+       metaprogramming::kNegativeOne});
+}
+
+template <typename JniT>
+constexpr std::size_t MethodIdxOf(std::string_view name) {
+  using MethodsT = std::decay_t<decltype(JniT::stripped_class_v.methods_)>;
+
+  return MethodIdxOf<JniT>(
+      name, std::make_index_sequence<std::tuple_size_v<MethodsT>>());
+}
+
+// Number of `Extends` between `JniT`'s class and the nearest class declaring a
+// method named `name` (0 if declared directly), or `kNegativeOne` if no class
+// in the hierarchy declares it.
+template <typename JniT>
+constexpr std::size_t MethodAncestryOf(std::string_view name) {
+  if (MethodIdxOf<JniT>(name) != metaprogramming::kNegativeOne) {
+    return 0;
+  }
+
+  if constexpr (std::is_same_v<std::decay_t<decltype(JniT::kParent)>,
+                               RootObject>) {
+    return metaprogramming::kNegativeOne;
+  } else {
+    std::size_t ancestry = MethodAncestryOf<typename JniT::ParentJniT>(name);
+
+    return ancestry == metaprogramming::kNegativeOne ? ancestry : ancestry + 1;
+  }
+}
+
+// The `OVERLOAD_SET` ID of the method at index `I` of the class declaring it,
+// `kAncestorIdx` `Extends` above `JniT`'s class (0 for `JniT`'s own methods).
+template <typename JniT, std::size_t I, std::size_t kAncestorIdx = 0>
+using MethodOverloadSetIdAt_t =
+    Id<JniT, IdType::OVERLOAD_SET, I, kNoIdx, kNoIdx, kAncestorIdx>;
+
+// The `OVERLOAD_SET` ID of the method `key_literal` on `JniT`'s class. `I` is
+// its index if declared directly, else `kNegativeOne`, in which case the
+// method is resolved on the nearest `Extends` ancestor declaring it.
+template <typename JniT, std::size_t I, auto key_literal>
+struct MethodOverloadSetId {
+  using type = MethodOverloadSetIdAt_t<JniT, I>;
+};
+
+template <typename JniT, auto key_literal>
+struct MethodOverloadSetId<JniT, metaprogramming::kNegativeOne, key_literal> {
+  static constexpr std::size_t kAncestorIdx =
+      MethodAncestryOf<JniT>(std::string_view{key_literal.value});
+  static_assert(kAncestorIdx != metaprogramming::kNegativeOne,
+                "JNI Error: No method with this name.");
+
+  static constexpr std::size_t kValidAncestorIdx =
+      kAncestorIdx == metaprogramming::kNegativeOne ? 0 : kAncestorIdx;
+  using AncestorJniT = typename Ancestor_t<
+      Id<JniT, IdType::CLASS, kNoIdx, kNoIdx, kNoIdx, kValidAncestorIdx>,
+      kValidAncestorIdx>::_JniT;
+
+  using type = MethodOverloadSetIdAt_t<
+      JniT, MethodIdxOf<AncestorJniT>(std::string_view{key_literal.value}),
+      kValidAncestorIdx>;
+};
+
+template <typename JniT, std::size_t I, auto key_literal>
+using MethodOverloadSetId_t =
+    typename MethodOverloadSetId<JniT, I, key_literal>::type;
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_METHOD_ANCESTRY_H_
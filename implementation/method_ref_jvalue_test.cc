@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::Constructor;
+using ::jni::ConstructWithJvalues;
+using ::jni::Fake;
+using ::jni::GlobalObject;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::StaticRef;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Invoke;
+
+TEST_F(JniTest, MethodRefJvalue_PacksPrimitivesByDeclaredSignature) {
+  static constexpr Class kClass{
+      "kClass",
+      Method{"Foo", Return<jint>{}, Params<jboolean, jchar, jlong, jdouble>{}},
+  };
+
+  EXPECT_CALL(*env_, CallIntMethodA(_, Fake<jmethodID>(), _))
+      .WillOnce(Invoke([](jobject, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].z, JNI_TRUE);
+        EXPECT_EQ(args[1].c, jchar{'a'});
+        EXPECT_EQ(args[2].j, jlong{1} << 40);
+        EXPECT_EQ(args[3].d, 2.5);
+        return 123;
+      }));
+  EXPECT_CALL(*env_, CallIntMethodV).Times(0);
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  EXPECT_EQ(obj.CallA<"Foo">(jboolean{true}, jchar{'a'}, jlong{1} << 40, 2.5),
+            123);
+}
+
+TEST_F(JniTest, MethodRefJvalue_PacksObjects) {
+  static constexpr Class kClass{
+      "kClass",
+      Method{"Foo", Return<void>{}, Params{Class{"kClass2"}, Class{"kClass3"}}},
+  };
+
+  EXPECT_CALL(*env_, CallVoidMethodA(_, Fake<jmethodID>(), _))
+      .WillOnce(Invoke([](jobject, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].l, Fake<jobject>(2));
+        EXPECT_EQ(args[1].l, Fake<jobject>(3));
+      }));
+
+  LocalObject<kClass> obj{Fake<jobject>(1)};
+  obj.CallA<"Foo">(Fake<jobject>(2), Fake<jobject>(3));
+}
+
+TEST_F(JniTest, MethodRefJvalue_StaticCallsUseJvalues) {
+  static constexpr Class kClass{
+      "kClass",
+      Static{Method{"Foo", Return<jfloat>{}, Params<jshort>{}}},
+  };
+
+  EXPECT_CALL(*env_, CallStaticFloatMethodA(_, _, _))
+      .WillOnce(Invoke([](jclass, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].s, jshort{7});
+        return 1.5f;
+      }));
+
+  EXPECT_EQ(StaticRef<kClass>{}.CallA<"Foo">(jshort{7}), 1.5f);
+}
+
+TEST_F(JniTest, MethodRefJvalue_NonvirtualCallsUseJvalues) {
+  static constexpr Class kClass{
+      "kClass",
+      Method{"Foo", Return<jdouble>{}, Params<jdouble>{}},
+  };
+
+  EXPECT_CALL(*env_, CallNonvirtualDoubleMethodA(_, _, Fake<jmethodID>(), _))
+      .WillOnce(Invoke([](jobject, jclass, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].d, 1.5);
+        return 2.5;
+      }));
+  EXPECT_CALL(*env_, CallNonvirtualDoubleMethodV).Times(0);
+  EXPECT_CALL(*env_, CallDoubleMethodA).Times(0);
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  EXPECT_EQ(obj.CallNonvirtualA<"Foo">(1.5), 2.5);
+}
+
+TEST_F(JniTest, MethodRefJvalue_ConstructorsUseNewObjectA) {
+  static constexpr Class kClass{"kClass", Constructor<jint, jlong>{}};
+
+  EXPECT_CALL(*env_, NewObjectA(_, Fake<jmethodID>(), _))
+      .WillOnce(Invoke([](jclass, jmethodID, const jvalue* args) {
+        EXPECT_EQ(args[0].i, 5);
+        EXPECT_EQ(args[1].j, jlong{1} << 40);
+        return Fake<jobject>();
+      }));
+  EXPECT_CALL(*env_, NewObjectV).Times(0);
+
+  LocalObject<kClass> obj{ConstructWithJvalues{}, 5, jlong{1} << 40};
+}
+
+TEST_F(JniTest, MethodRefJvalue_GlobalsConstructWithNewObjectA) {
+  static constexpr Class kClass{"kClass", Constructor<jint>{}};
+
+  EXPECT_CALL(*env_, NewObjectA(_, Fake<jmethodID>(), _))
+      .WillOnce(::testing::Return(Fake<jobject>(1)));
+  EXPECT_CALL(*env_, NewGlobalRef(Fake<jobject>(1)))
+      .WillOnce(::testing::Return(Fake<jobject>(2)));
+  EXPECT_CALL(*env_, DeleteLocalRef(Fake<jobject>(1)));
+
+  GlobalObject<kClass> obj{ConstructWithJvalues{}, 5};
+}
+
+TEST_F(JniTest, MethodRefJvalue_CallStillUsesVarargs) {
+  static constexpr Class kClass{
+      "kClass",
+      Method{"Foo", Return<jint>{}, Params<jint>{}},
+  };
+
+  EXPECT_CALL(*env_, CallIntMethodV(_, Fake<jmethodID>(), _))
+      .WillOnce(::testing::Return(1));
+  EXPECT_CALL(*env_, CallIntMethodA).Times(0);
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  EXPECT_EQ(obj.Call<"Foo">(5), 1);
+}
+
+}  // namespace
@@ -92,7 +92,7 @@ struct MethodSelection {
   template <std::size_t I, typename... Ts>
   struct Helper {
     using type = metaprogramming::Val_t<OverloadSelection<
-        Id<_JniT, kIDType, IdT::kIdx, I, kNoIdx, 0>,
+        Id<_JniT, kIDType, IdT::kIdx, I, kNoIdx, IdT::kAncestorIdx>,
         kReturnIDType>::template OverloadIdxIfViable<Ts...>()>;
   };
 
@@ -103,7 +103,8 @@ struct MethodSelection {
 
   template <typename... Ts>
   using FindOverloadSelection = OverloadSelection<
-      Id<_JniT, kIDType, IdT::kIdx, kIdxForTs<Ts...>, kNoIdx, 0>,
+      Id<_JniT, kIDType, IdT::kIdx, kIdxForTs<Ts...>, kNoIdx,
+         IdT::kAncestorIdx>,
       kReturnIDType>;
 
   template <typename... Ts>
@@ -119,7 +120,8 @@ struct OverloadSelector {
 
   using _OverloadRef =
       OverloadRef<Id<typename IdT::_JniT, kIDType, IdT::kIdx,
-                     OverloadSelectionForArgs::IdT::kSecondaryIdx, kNoIdx, 0>,
+                     OverloadSelectionForArgs::IdT::kSecondaryIdx, kNoIdx,
+                     IdT::kAncestorIdx>,
                   kReturnIDType>;
 
   static constexpr bool kIsValidArgSet =
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_NATIVE_METHODS_H_
+#define JNI_BIND_IMPLEMENTATION_NATIVE_METHODS_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "implementation/class_ref.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/id.h"
+#include "implementation/id_type.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_type.h"
+#include "implementation/jvm.h"
+#include "implementation/no_idx.h"
+#include "implementation/signature.h"
+#include "jni_dep.h"
+#include "metaprogramming/invocable_map_20.h"
+#include "metaprogramming/modified_max.h"
+#include "metaprogramming/string_literal.h"
+
+namespace jni {
+
+#if __cplusplus >= 202002L
+// Binds the C++ function `fn_` to the method `name_` of a `NativeMethods`
+// class.
+template <metaprogramming::StringLiteral name_, auto fn_>
+struct Native {
+  static constexpr metaprogramming::StringLiteral kName = name_;
+  static constexpr auto kFn = fn_;
+};
+
+// Resolves a `Native` against the method of the same name in `class_v` (or
+// its `Static` block), selecting the overload whose C declaration matches
+// `fn_` exactly.
+template <const auto& class_v, typename NativeT>
+struct NativeMethodHelper {
+  using JniT_ = JniT<jobject, class_v, kDefaultClassLoader, kDefaultJvm>;
+  using ClassT = typename JniT_::ClassT;
+  using StaticT = typename JniT_::StaticT;
+
+  using MethodsT = std::decay_t<decltype(JniT_::stripped_class_v.methods_)>;
+  using StaticMethodsT = std::decay_t<decltype(JniT_::static_v.methods_)>;
+
+  static constexpr std::size_t kInstanceIdx =
+      metaprogramming::InvocableMap20<
+          void, JniT_::stripped_class_v, ClassT, decltype(&ClassT::methods_),
+          &ClassT::methods_>::
+          SelectCandidate(
+              NativeT::kName,
+              std::make_index_sequence<std::tuple_size_v<MethodsT>>());
+
+  static constexpr std::size_t kStaticIdx =
+      metaprogramming::InvocableMap20<void, JniT_::static_v, StaticT,
+                                      decltype(&StaticT::methods_),
+                                      &StaticT::methods_>::
+          SelectCandidate(
+              NativeT::kName,
+              std::make_index_sequence<std::tuple_size_v<StaticMethodsT>>());
+
+  static constexpr bool kIsStatic =
+      kInstanceIdx == metaprogramming::kNegativeOne;
+  static_assert(!kIsStatic || kStaticIdx != metaprogramming::kNegativeOne,
+                "JNI Error: No method with this name.");
+
+  static constexpr std::size_t kIdx = kIsStatic ? kStaticIdx : kInstanceIdx;
+  using SetIdT =
+      Id<JniT_, kIsStatic ? IdType::STATIC_OVERLOAD_SET : IdType::OVERLOAD_SET,
+         kIdx, kNoIdx, kNoIdx, 0>;
+
+  // The C declaration a native implementation of overload `I` must have.
+  template <std::size_t I>
+  struct OverloadFn {
+    using OverloadIdT =
+        Id<JniT_, kIsStatic ? IdType::STATIC_OVERLOAD : IdType::OVERLOAD, kIdx,
+           I, kNoIdx, 0>;
+
+    template <std::size_t param_idx>
+    using ParamIdT = Id<JniT_,
+                        kIsStatic ? IdType::STATIC_OVERLOAD_PARAM
+                                  : IdType::OVERLOAD_PARAM,
+                        kIdx, I, param_idx, 0>;
+
+    template <typename IdxSeq>
+    struct Helper;
+
+    template <std::size_t... Is>
+    struct Helper<std::index_sequence<Is...>> {
+      using type = typename ParamIdT<kNoIdx>::CDecl (*)(
+          JNIEnv*, std::conditional_t<kIsStatic, jclass, jobject>,
+          typename ParamIdT<Is>::CDecl...);
+    };
+
+    using type = typename Helper<
+        std::make_index_sequence<OverloadIdT::kNumParams>>::type;
+
+    static constexpr bool kMatches =
+        std::is_same_v<type, std::decay_t<decltype(NativeT::kFn)>>;
+  };
+
+  template <std::size_t... Is>
+  static constexpr std::size_t SelectOverload(std::index_sequence<Is...>) {
+    return metaprogramming::ModifiedMax(
+        {(OverloadFn<Is>::kMatches ? std::size_t{Is}
+                                   : metaprogramming::kNegativeOne)...,
+         metaprogramming::kNegativeOne});
+  }
+
+  static constexpr std::size_t kOverloadIdx =
+      SelectOverload(std::make_index_sequence<SetIdT::kNumParams>());
+  static_assert(kOverloadIdx != metaprogramming::kNegativeOne,
+                "JNI Error: Native function's type does not match any "
+                "overload, expected e.g. `jint (*)(JNIEnv*, jobject, jint)` "
+                "(`jclass` for static methods).");
+
+  using OverloadIdT = typename OverloadFn<kOverloadIdx>::OverloadIdT;
+
+  static JNINativeMethod Entry() {
+    return {const_cast<char*>(OverloadIdT::Name()),
+            const_cast<char*>(Signature_v<OverloadIdT>.data()),
+            reinterpret_cast<void*>(NativeT::kFn)};
+  }
+};
+
+// A table of native implementations for methods of `class_v`, whose JNI
+// signatures are derived from the `class_v` definition.  Registering them
+// with `RegisterNatives` (typically in `JNI_OnLoad`) avoids the JVM's symbol
+// lookup of `Java_...` exports on first call.
+//
+// The type of each function is checked at compile time against the declared
+// method: it must take `JNIEnv*`, then `jobject` (or `jclass` for methods in
+// `Static`), then the method's parameters.
+//
+//   static constexpr Class kClass{
+//       "com/foo/Bar",
+//       Static{Method{"nativeInit", Return{}, Params{}}},
+//       Method{"nativeAdd", Return<jint>{}, Params<jint, jint>{}},
+//   };
+//
+//   jint Add(JNIEnv*, jobject, jint a, jint b) { return a + b; }
+//   void Init(JNIEnv*, jclass) {}
+//
+//   NativeMethods<kClass, Native<"nativeAdd", &Add>,
+//                 Native<"nativeInit", &Init>>::Register();
+template <const auto& class_v, typename... Natives>
+struct NativeMethods {
+  static_assert(sizeof...(Natives) > 0, "No native methods to register.");
+
+  // Registers every native with a single `RegisterNatives` call, returning
+  // its result (0 on success).
+  static jint Register() {
+    using JniT_ = JniT<jobject, class_v, kDefaultClassLoader, kDefaultJvm>;
+
+    const JNINativeMethod methods[] = {
+        NativeMethodHelper<class_v, Natives>::Entry()...};
+
+    return JniHelper::RegisterNatives(
+        ClassRef_t<JniT_>::GetAndMaybeLoadClassRef(nullptr), methods,
+        static_cast<jint>(sizeof...(Natives)));
+  }
+};
+#endif  // __cplusplus >= 202002L
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_NATIVE_METHODS_H_
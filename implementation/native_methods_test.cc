@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::Fake;
+using ::jni::Method;
+using ::jni::Native;
+using ::jni::NativeMethods;
+using ::jni::Overload;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::test::AsGlobal;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::Eq;
+
+static constexpr Class kClass2{"kClass2"};
+
+static constexpr Class kClass{
+    "kClass",
+    Static{
+        Method{"nativeStatic", Return<jlong>{}, Params<jstring>{}},
+    },
+    Method{"nativeFoo", Return<jint>{}, Params<jint, jfloat>{}},
+    Method{"nativeBar", Return{kClass2}, Params{kClass2}},
+    Method{"nativeOverload",
+           Overload{Return<void>{}, Params<>{}},
+           Overload{Return<void>{}, Params<jint>{}}},
+};
+
+jint Foo(JNIEnv*, jobject, jint, jfloat) { return 0; }
+jobject Bar(JNIEnv*, jobject, jobject obj) { return obj; }
+jlong StaticFn(JNIEnv*, jclass, jstring) { return 0; }
+void OverloadWithInt(JNIEnv*, jobject, jint) {}
+
+struct Registered {
+  std::string name;
+  std::string signature;
+  void* fn_ptr;
+};
+
+std::vector<Registered> Capture(const JNINativeMethod* methods, jint size) {
+  std::vector<Registered> ret;
+  for (jint i = 0; i < size; ++i) {
+    ret.push_back({methods[i].name, methods[i].signature, methods[i].fnPtr});
+  }
+  return ret;
+}
+
+TEST_F(JniTest, NativeMethods_RegistersAllMethodsInOneCall) {
+  std::vector<Registered> registered;
+  EXPECT_CALL(*env_, RegisterNatives(AsGlobal(Fake<jclass>()), _, 3))
+      .WillOnce([&](jclass, const JNINativeMethod* methods, jint size) {
+        registered = Capture(methods, size);
+        return JNI_OK;
+      });
+
+  EXPECT_EQ((NativeMethods<kClass, Native<"nativeFoo", &Foo>,
+                           Native<"nativeBar", &Bar>,
+                           Native<"nativeStatic", &StaticFn>>::Register()),
+            JNI_OK);
+
+  ASSERT_EQ(registered.size(), 3);
+  EXPECT_EQ(registered[0].name, "nativeFoo");
+  EXPECT_EQ(registered[0].signature, "(IF)I");
+  EXPECT_EQ(registered[0].fn_ptr, reinterpret_cast<void*>(&Foo));
+  EXPECT_EQ(registered[1].name, "nativeBar");
+  EXPECT_EQ(registered[1].signature, "(LkClass2;)LkClass2;");
+  EXPECT_EQ(registered[1].fn_ptr, reinterpret_cast<void*>(&Bar));
+  EXPECT_EQ(registered[2].name, "nativeStatic");
+  EXPECT_EQ(registered[2].signature, "(Ljava/lang/String;)J");
+  EXPECT_EQ(registered[2].fn_ptr, reinterpret_cast<void*>(&StaticFn));
+}
+
+TEST_F(JniTest, NativeMethods_SelectsOverloadByFunctionType) {
+  std::vector<Registered> registered;
+  EXPECT_CALL(*env_, RegisterNatives(_, _, 1))
+      .WillOnce([&](jclass, const JNINativeMethod* methods, jint size) {
+        registered = Capture(methods, size);
+        return JNI_OK;
+      });
+
+  NativeMethods<kClass,
+                Native<"nativeOverload", &OverloadWithInt>>::Register();
+
+  ASSERT_EQ(registered.size(), 1);
+  EXPECT_EQ(registered[0].name, "nativeOverload");
+  EXPECT_EQ(registered[0].signature, "(I)V");
+}
+
+TEST_F(JniTest, NativeMethods_ReturnsRegisterNativesError) {
+  EXPECT_CALL(*env_, RegisterNatives).WillOnce(::testing::Return(JNI_ERR));
+
+  EXPECT_THAT((NativeMethods<kClass, Native<"nativeFoo", &Foo>>::Register()),
+              Eq(JNI_ERR));
+}
+
+}  // namespace
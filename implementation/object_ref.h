@@ -19,22 +19,28 @@
 
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
+#include <atomic>
 #include <cstddef>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
 #include "implementation/class_ref.h"
+#include "implementation/default_class_loader.h"
 #include "implementation/field_ref.h"
 #include "implementation/id.h"
 #include "implementation/id_type.h"
 #include "implementation/jni_helper/lifecycle.h"
 #include "implementation/jni_type.h"
+#include "implementation/method_ancestry.h"
 #include "implementation/method_selection.h"
 #include "implementation/no_idx.h"
 #include "implementation/ref_base.h"
 #include "jni_dep.h"
 #include "metaprogramming/invocable_map.h"
 #include "metaprogramming/invocable_map_20.h"
+#include "metaprogramming/modified_max.h"
 #include "metaprogramming/queryable_map.h"
 #include "metaprogramming/queryable_map_20.h"
 #include "metaprogramming/string_contains.h"
@@ -42,6 +48,31 @@
 
 namespace jni {
 
+// For classes of non-default loaders, remembers the `jclass` of the loader
+// instance an object belongs to (see `ClassRef`), so it is only resolved once
+// per object. Empty for the default loader.
+template <typename JniT,
+          bool kIsDefaultLoader = JniT::class_loader_v == kDefaultClassLoader>
+struct LoaderClassMemo {};
+
+template <typename JniT>
+struct LoaderClassMemo<JniT, false> {
+  LoaderClassMemo() = default;
+
+  LoaderClassMemo(const LoaderClassMemo& rhs)
+      : loader_class_(rhs.loader_class_.load(std::memory_order_relaxed)) {}
+
+  LoaderClassMemo& operator=(const LoaderClassMemo& rhs) {
+    loader_class_.store(rhs.loader_class_.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+    return *this;
+  }
+
+  // Objects built by a `ClassLoaderRef` start with that instance's class.
+  mutable std::atomic<jclass> loader_class_{
+      ClassRef_t<JniT>::BuildingClassRef()};
+};
+
 // Represents a runtime instance of a JNI Object.  Instead of using this class
 // directly, instead the more specialised types such as LocalObject,
 // GlobalObject, etc.
@@ -64,7 +95,8 @@ class ObjectRef
       public metaprogramming::QueryableMap20<
           ObjectRef<JniT>, JniT::stripped_class_v, ObjectRef<JniT>,
           decltype(&JniT::ClassT::fields_), &JniT::ClassT::fields_>,
-      public RefBase<typename JniT::StorageType> {
+      public RefBase<typename JniT::StorageType>,
+      public LoaderClassMemo<JniT> {
  protected:
   static_assert(
       JniT::class_loader_v
@@ -83,7 +115,18 @@ class ObjectRef
     // Args are passed to recover class ref from class loader, and nullptr is
     // always safe. `GetAndMaybeLoadClassRef` requires jobject, so using
     // `RefBase::object_ref_` below obiates ubsan failures.
-    if constexpr (std::is_same_v<typename JniT::SpanType, jobject>) {
+    if constexpr (JniT::class_loader_v != kDefaultClassLoader) {
+      jclass loader_class =
+          LoaderClassMemo<JniT>::loader_class_.load(std::memory_order_relaxed);
+      if (loader_class == nullptr) {
+        loader_class =
+            ClassRef_t<JniT>::GetAndMaybeLoadClassRef(RefBaseT::object_ref_);
+        LoaderClassMemo<JniT>::loader_class_.store(loader_class,
+                                                   std::memory_order_relaxed);
+      }
+
+      return loader_class;
+    } else if constexpr (std::is_same_v<typename JniT::SpanType, jobject>) {
       return ClassRef_t<JniT>::GetAndMaybeLoadClassRef(RefBaseT::object_ref_);
     } else {
       return ClassRef_t<JniT>::GetAndMaybeLoadClassRef(nullptr);
@@ -131,10 +174,11 @@ class ObjectRef
 ////////////////////////////////////////////////////////////////////////////////
 #if __cplusplus >= 202002L
   // Invoked through CRTP from InvocableMap, C++20 only.
+  // Methods not declared on this class are found on its `Extends` ancestors.
   template <size_t I, metaprogramming::StringLiteral key_literal,
             typename... Args>
   auto InvocableMap20Call(Args&&... args) const {
-    using IdT = Id<JniT, IdType::OVERLOAD_SET, I, kNoIdx, kNoIdx, 0>;
+    using IdT = MethodOverloadSetId_t<JniT, I, key_literal>;
     using MethodSelectionForArgs =
         OverloadSelector<IdT, IdType::OVERLOAD, IdType::OVERLOAD_PARAM,
                          Args...>;
@@ -146,6 +190,85 @@ class ObjectRef
         GetJClass(), RefBaseT::object_ref_, std::forward<Args>(args)...);
   }
 
+  // Like `Call`, but arguments are passed to the JVM as a `jvalue` array
+  // (`Call<Type>MethodA`) rather than as C varargs.
+  template <metaprogramming::StringLiteral key_literal, typename... Args>
+  auto CallA(Args&&... args) const {
+    using MethodsT = std::decay_t<decltype(JniT::stripped_class_v.methods_)>;
+    using InvocableMap20T = metaprogramming::InvocableMap20<
+        ObjectRef<JniT>, JniT::stripped_class_v, ObjectRef<JniT>,
+        decltype(&JniT::ClassT::methods_), &JniT::ClassT::methods_>;
+
+    constexpr std::size_t I = InvocableMap20T::SelectCandidate(
+        key_literal, std::make_index_sequence<std::tuple_size_v<MethodsT>>());
+    static_assert(I != metaprogramming::kNegativeOne ||
+                      MethodAncestryOf<JniT>(std::string_view{
+                          key_literal.value}) != metaprogramming::kNegativeOne,
+                  "JNI Error: No method with this name.");
+
+    using IdT = MethodOverloadSetId_t<JniT, I, key_literal>;
+    using MethodSelectionForArgs =
+        OverloadSelector<IdT, IdType::OVERLOAD, IdType::OVERLOAD_PARAM,
+                         Args...>;
+
+    static_assert(MethodSelectionForArgs::kIsValidArgSet,
+                  "JNI Error: Invalid argument set.");
+
+    return MethodSelectionForArgs::_OverloadRef::InvokeA(
+        GetJClass(), RefBaseT::object_ref_, std::forward<Args>(args)...);
+  }
+
+  // Like `Call`, but invokes the implementation on this object's declared
+  // class with `CallNonvirtual<Type>Method`, e.g. for final or private
+  // methods, or to pin a call to an `Extends` ancestor by viewing the object
+  // through the ancestor's class. Methods not declared on this class run the
+  // implementation of the nearest `Extends` ancestor declaring them.
+  template <metaprogramming::StringLiteral key_literal, typename... Args>
+  auto CallNonvirtual(Args&&... args) const {
+    using MethodsT = std::decay_t<decltype(JniT::stripped_class_v.methods_)>;
+    using InvocableMap20T = metaprogramming::InvocableMap20<
+        ObjectRef<JniT>, JniT::stripped_class_v, ObjectRef<JniT>,
+        decltype(&JniT::ClassT::methods_), &JniT::ClassT::methods_>;
+
+    constexpr std::size_t I = InvocableMap20T::SelectCandidate(
+        key_literal, std::make_index_sequence<std::tuple_size_v<MethodsT>>());
+
+    using IdT = MethodOverloadSetId_t<JniT, I, key_literal>;
+    using MethodSelectionForArgs =
+        OverloadSelector<IdT, IdType::OVERLOAD, IdType::OVERLOAD_PARAM,
+                         Args...>;
+
+    static_assert(MethodSelectionForArgs::kIsValidArgSet,
+                  "JNI Error: Invalid argument set.");
+
+    return MethodSelectionForArgs::_OverloadRef::InvokeNonvirtual(
+        GetJClass(), RefBaseT::object_ref_, std::forward<Args>(args)...);
+  }
+
+  // Like `CallNonvirtual`, but arguments are passed to the JVM as a `jvalue`
+  // array (`CallNonvirtual<Type>MethodA`) rather than as C varargs.
+  template <metaprogramming::StringLiteral key_literal, typename... Args>
+  auto CallNonvirtualA(Args&&... args) const {
+    using MethodsT = std::decay_t<decltype(JniT::stripped_class_v.methods_)>;
+    using InvocableMap20T = metaprogramming::InvocableMap20<
+        ObjectRef<JniT>, JniT::stripped_class_v, ObjectRef<JniT>,
+        decltype(&JniT::ClassT::methods_), &JniT::ClassT::methods_>;
+
+    constexpr std::size_t I = InvocableMap20T::SelectCandidate(
+        key_literal, std::make_index_sequence<std::tuple_size_v<MethodsT>>());
+
+    using IdT = MethodOverloadSetId_t<JniT, I, key_literal>;
+    using MethodSelectionForArgs =
+        OverloadSelector<IdT, IdType::OVERLOAD, IdType::OVERLOAD_PARAM,
+                         Args...>;
+
+    static_assert(MethodSelectionForArgs::kIsValidArgSet,
+                  "JNI Error: Invalid argument set.");
+
+    return MethodSelectionForArgs::_OverloadRef::InvokeNonvirtualA(
+        GetJClass(), RefBaseT::object_ref_, std::forward<Args>(args)...);
+  }
+
   // Invoked through CRTP from QueryableMap20, C++20 only.
   template <size_t I, metaprogramming::StringLiteral key_literal>
   auto QueryableMap20Call() const {
@@ -154,6 +277,11 @@ class ObjectRef
 #endif  // __cplusplus >= 202002L
 };
 
+// Tag to construct with `NewObjectA`, passing the constructor arguments as a
+// `jvalue` array rather than as C varargs (as `CallA` does for methods), e.g.
+// `LocalObject<kClass> obj{ConstructWithJvalues{}, 1, 2.f}`.
+struct ConstructWithJvalues {};
+
 // Imbues constructors for ObjectRefs and handles calling the correct
 // intermediate constructors.  Access to this class is constrained for non
 // default classloaders (see |ValidatorProxy|).
@@ -191,17 +319,34 @@ class ConstructorValidator : public ObjectRef<JniT> {
   ConstructorValidator(Args&&... args)
       : Base(static_cast<typename JniT::StorageType>(
             Permutation_t<Args...>::_OverloadRef::Invoke(
-                Base::GetJClass(), Base::object_ref_,
-                std::forward<Args>(args)...)
+                ConstructionJClass(), nullptr, std::forward<Args>(args)...)
+                .Release())) {
+    static_assert(Permutation_t<Args...>::kIsValidArgSet,
+                  "You have passed invalid arguments to construct this type.");
+  }
+
+  template <typename... Args>
+  ConstructorValidator(ConstructWithJvalues, Args&&... args)
+      : Base(static_cast<typename JniT::StorageType>(
+            Permutation_t<Args...>::_OverloadRef::InvokeA(
+                ConstructionJClass(), nullptr, std::forward<Args>(args)...)
                 .Release())) {
+    static_assert(JniT::kRank == 0, "Arrays are not constructed this way.");
     static_assert(Permutation_t<Args...>::kIsValidArgSet,
                   "You have passed invalid arguments to construct this type.");
   }
 
   ConstructorValidator()
-      : Base(Permutation_t<>::_OverloadRef::Invoke(Base::GetJClass(),
-                                                   Base::object_ref_)
+      : Base(Permutation_t<>::_OverloadRef::Invoke(ConstructionJClass(),
+                                                   nullptr)
                  .Release()) {}
+
+ private:
+  // The class to construct with. The object (and so `GetJClass`) is not yet
+  // available, and there is no receiver for a constructor.
+  static jclass ConstructionJClass() {
+    return ClassRef_t<JniT>::GetAndMaybeLoadClassRef(nullptr);
+  }
 };
 
 // Forward declaration for constructor validator (ctor augmentations).
@@ -19,17 +19,27 @@
 
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 
+#include "implementation/class_keyed_map.h"
+#include "implementation/class_ref.h"
 #include "implementation/configuration.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/id_table.h"
 #include "implementation/id_type.h"
 #include "implementation/jni_helper/invoke.h"
+#include "implementation/jni_helper/invoke_nonvirtual.h"
 #include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_helper/jvalue.h"
 #include "implementation/jni_helper/lifecycle.h"
 #include "implementation/jni_helper/lifecycle_object.h"
+#include "implementation/no_idx.h"
 #include "implementation/promotion_mechanics_tags.h"
 #include "implementation/proxy_convenience_aliases.h"
 #include "implementation/proxy_definitions.h"
@@ -37,7 +47,9 @@
 #include "implementation/proxy_definitions_string.h"
 #include "implementation/ref_base.h"
 #include "implementation/ref_storage.h"
+#include "implementation/selector_static_info.h"
 #include "implementation/signature.h"
+#include "implementation/startup_profile.h"
 #include "jni_dep.h"
 #include "metaprogramming/double_locked_value.h"
 #include "metaprogramming/string_concatenate.h"
@@ -46,10 +58,16 @@ namespace jni {
 
 // Transforms a OverloadRef IdT into a fully qualified ID. Storage is keyed
 // against these IDs to reduce excess MethodID lookups.
+//
+// Inherited methods are qualified by the `Extends` ancestor declaring them, so
+// every descendant shares one entry.
 template <typename IdT>
 struct OverloadRefUniqueId {
+  using DeclaringIdT = Ancestor_t<IdT, IdT::kAncestorIdx>;
+
   static constexpr std::string_view kDash = "#";
-  static constexpr std::string_view kClassQualifier{IdT::Class().name_};
+  static constexpr std::string_view kClassQualifier{
+      DeclaringIdT::Class().name_};
   static constexpr std::string_view kOverloadName{IdT::Name()};
 
   // IdT::Name will be the overload name (e.g. "Foo").
@@ -72,62 +90,233 @@ struct OverloadRef {
       Return_t<typename SelfIdT::MaterializeCDeclT, SelfIdT>,
       Return_t<typename ReturnIdT::MaterializeCDeclT, ReturnIdT>>;
 
+  // Key and entry for `StartupProfile` (default class loader only).
+  static constexpr std::string_view kProfileKey =
+      OverloadRefUniqueId<IdT>::TypeName();
+
+  static StartupProfileEntry ProfileEntry() {
+    return {IdT::Class().name_, IdT::Name(), Signature_v<IdT>.data(),
+            +[]() {
+              return ClassRef_t<typename IdT::_JniT>::GetAndMaybeLoadClassRef(
+                  nullptr);
+            },
+            +[](jclass clazz) { return GetMethodID(clazz) != nullptr; }};
+  }
+
   static jmethodID GetMethodID(jclass clazz) {
-    static auto get_lambda =
-        [clazz](metaprogramming::DoubleLockedValue<jmethodID>* storage) {
-          if (kConfiguration.release_method_ids_on_teardown_) {
-            DefaultRefs<jmethodID>().push_back(storage);
-          }
-
-          if constexpr (IdT::kIsStatic) {
-            return jni::JniHelper::GetStaticMethodID(clazz, IdT::Name(),
-                                                     Signature_v<IdT>.data());
-          } else {
-            return jni::JniHelper::GetMethodID(clazz, IdT::Name(),
-                                               Signature_v<IdT>.data());
-          }
-        };
-
-    return RefStorage<decltype(get_lambda), OverloadRefUniqueId<IdT>>::Get(
-        get_lambda);
+    static constexpr bool kIsProfiled =
+        IdT::_JniT::GetClassLoader() == kDefaultClassLoader;
+
+    static constexpr bool kIsInherited =
+        IdT::kAncestorIdx != 0 && !IdT::kIsStatic;
+
+    // Inherited methods are registered by their declaring ancestor's
+    // `OverloadRef` (see below).
+    if constexpr (kIsProfiled && !kIsInherited) {
+      static_cast<void>(StartupProfileRegistration<OverloadRef>::kRegistered);
+    }
+
+    auto get_lambda = [clazz]() {
+      jmethodID mthd;
+      if constexpr (IdT::kIsStatic) {
+        mthd = jni::JniHelper::GetStaticMethodID(clazz, IdT::Name(),
+                                                 Signature_v<IdT>.data());
+      } else {
+        mthd = jni::JniHelper::GetMethodID(clazz, IdT::Name(),
+                                           Signature_v<IdT>.data());
+      }
+
+      if (kIsProfiled && mthd != nullptr) {
+        StartupProfile::MaybeRecord(kProfileKey);
+      }
+
+      return mthd;
+    };
+
+    const std::uint32_t generation =
+        IdGeneration<jmethodID>().load(std::memory_order_relaxed);
+
+    // IDs declared directly on the class live in its dense `IdTable`.
+    using IdTableT = IdTable<typename IdT::_JniT::MinimallySpanningType>;
+    if constexpr (!kIsProfiled) {
+      // Non-default loaders keep IDs per loaded `jclass` (see `ClassRef`).
+      metaprogramming::DoubleLockedValue<jmethodID>* storage;
+      if constexpr (IdTableT::template MethodSlot<IdT>() != kNoIdx) {
+        storage = IdTableT::template MethodId<IdT>(clazz);
+      } else {
+        storage = class_keyed_ids_.FindOrInsert(clazz);
+      }
+
+      return storage ? storage->LoadAndMaybeInit(get_lambda, generation)
+                     : get_lambda();
+    } else if constexpr (kIsInherited) {
+      // Inherited instance methods are the declaring ancestor's, so they share
+      // its `IdTable` slot and startup profile entry. The ID is valid for, and
+      // dispatches virtually on, instances of any of its descendants.
+      using DeclaringIdT = Ancestor_t<IdT, IdT::kAncestorIdx>;
+
+      return OverloadRef<DeclaringIdT, kReturnIDType>::GetMethodID(
+          ClassRef_t<typename DeclaringIdT::_JniT>::GetAndMaybeLoadClassRef(
+              nullptr));
+    } else if constexpr (IdTableT::template MethodSlot<IdT>() != kNoIdx) {
+      return IdTableT::template MethodId<IdT>().LoadAndMaybeInit(get_lambda,
+                                                                 generation);
+    } else {
+      auto storage_lambda =
+          [&get_lambda](metaprogramming::DoubleLockedValue<jmethodID>*) {
+            return get_lambda();
+          };
+
+      return RefStorage<decltype(storage_lambda),
+                        OverloadRefUniqueId<IdT>>::Get(storage_lambda,
+                                                       generation);
+    }
   }
 
-  template <typename... Params>
-  static ReturnProxied Invoke(jclass clazz, jobject object,
-                              Params&&... params) {
-    constexpr std::size_t kRank = ReturnIdT::kRank;
-    constexpr bool kStatic = ReturnIdT::kIsStatic;
-    const jmethodID mthd = OverloadRef::GetMethodID(clazz);
+  // Packs already proxied arguments into a stack allocated `jvalue` array. The
+  // union member for each argument is selected from the signature of its
+  // declared parameter, not from the type of the argument itself.
+  template <std::size_t... Is, typename... Ts>
+  static std::array<jvalue, sizeof...(Ts)> ToJvalues(
+      std::index_sequence<Is...>, const Ts&... ts) {
+    return {ToJvalue<Signature_v<
+        typename ReturnIdT::template ChangeIdx<2, Is>>[0]>(ts)...};
+  }
+
+  // Invokes through `Helper` using either the C varargs JNI entry points or,
+  // if `kJvalue`, their `jvalue*` counterparts (e.g. `CallIntMethodA`) which
+  // need not re-walk the method signature.
+  template <typename Helper, bool kJvalue, typename... Ts>
+  static auto InvokeHelperWithArgs(jobject object, jclass clazz,
+                                   jmethodID mthd, Ts&&... ts) {
+    if constexpr (kJvalue) {
+      return Helper::InvokeA(
+          object, clazz, mthd,
+          ToJvalues(std::index_sequence_for<Ts...>{}, ts...).data());
+    } else {
+      return Helper::Invoke(object, clazz, mthd, std::forward<Ts>(ts)...);
+    }
+  }
 
+  template <bool kJvalue, typename... Ts>
+  static jobject Construct(jclass clazz, jmethodID mthd, Ts&&... ts) {
+    using Lifecycle = LifecycleHelper<jobject, LifecycleType::LOCAL>;
+
+    if constexpr (kJvalue) {
+      return Lifecycle::ConstructA(
+          clazz, mthd,
+          ToJvalues(std::index_sequence_for<Ts...>{}, ts...).data());
+    } else {
+      return Lifecycle::Construct(clazz, mthd, std::forward<Ts>(ts)...);
+    }
+  }
+
+  // Selects `InvokeHelper` or, for non-virtual calls, its
+  // `CallNonvirtual<Type>Method` counterpart.
+  template <typename CDecl, bool kNonvirtual>
+  using Helper_t = std::conditional_t<
+      kNonvirtual, InvokeNonvirtualHelper<CDecl, ReturnIdT::kRank>,
+      InvokeHelper<CDecl, ReturnIdT::kRank, ReturnIdT::kIsStatic>>;
+
+  template <bool kNonvirtual, bool kJvalue, typename... Params>
+  static ReturnProxied InvokeImpl(jclass clazz, jmethodID mthd, jobject object,
+                                  Params&&... params) {
     if constexpr (std::is_same_v<ReturnProxied, void>) {
-      return InvokeHelper<void, kRank, kStatic>::Invoke(
+      return InvokeHelperWithArgs<Helper_t<void, kNonvirtual>, kJvalue>(
           object, clazz, mthd,
           ForwardWithProxyTemporaryStrip(
               Proxy_t<Params>::ProxyAsArg(std::forward<Params>(params)))...);
     } else if constexpr (IdT::kIsConstructor) {
       return ReturnProxied{
           AdoptLocal{},
-          LifecycleHelper<jobject, LifecycleType::LOCAL>::Construct(
+          Construct<kJvalue>(
               clazz, mthd,
               ForwardWithProxyTemporaryStrip(Proxy_t<Params>::ProxyAsArg(
                   std::forward<Params>(params)))...)};
     } else {
+      using Helper = Helper_t<typename ReturnIdT::CDecl, kNonvirtual>;
+
       if constexpr (std::is_base_of_v<RefBaseBase, ReturnProxied>) {
         return ReturnProxied{
             AdoptLocal{},
-            InvokeHelper<typename ReturnIdT::CDecl, kRank, kStatic>::Invoke(
+            InvokeHelperWithArgs<Helper, kJvalue>(
                 object, clazz, mthd,
                 ForwardWithProxyTemporaryStrip(Proxy_t<Params>::ProxyAsArg(
                     std::forward<Params>(params)))...)};
       } else {
         return static_cast<ReturnProxied>(
-            InvokeHelper<typename ReturnIdT::CDecl, kRank, kStatic>::Invoke(
+            InvokeHelperWithArgs<Helper, kJvalue>(
                 object, clazz, mthd,
                 ForwardWithProxyTemporaryStrip(Proxy_t<Params>::ProxyAsArg(
                     std::forward<Params>(params)))...));
       }
     }
   }
+
+  template <typename... Params>
+  static ReturnProxied Invoke(jclass clazz, jobject object,
+                              Params&&... params) {
+    return InvokeImpl<false, false>(clazz, OverloadRef::GetMethodID(clazz),
+                                    object, std::forward<Params>(params)...);
+  }
+
+  // As `Invoke`, but arguments are passed as a `jvalue` array (e.g. through
+  // `CallIntMethodA`) rather than as C varargs.
+  template <typename... Params>
+  static ReturnProxied InvokeA(jclass clazz, jobject object,
+                               Params&&... params) {
+    return InvokeImpl<false, true>(clazz, OverloadRef::GetMethodID(clazz),
+                                   object, std::forward<Params>(params)...);
+  }
+
+  // Invokes with an already resolved `mthd` (see `BoundMethod`).
+  template <typename... Params>
+  static ReturnProxied InvokeWithMethodID(jclass clazz, jmethodID mthd,
+                                          jobject object, Params&&... params) {
+    return InvokeImpl<false, false>(clazz, mthd, object,
+                                    std::forward<Params>(params)...);
+  }
+
+  // Constructs with an already resolved `mthd` (see `ConstructAll`). The new
+  // local reference is returned unwrapped.
+  template <typename... Params>
+  static jobject ConstructWithMethodID(jclass clazz, jmethodID mthd,
+                                       Params&&... params) {
+    static_assert(IdT::kIsConstructor, "Only constructors can be constructed.");
+
+    return Construct<false>(
+        clazz, mthd,
+        ForwardWithProxyTemporaryStrip(
+            Proxy_t<Params>::ProxyAsArg(std::forward<Params>(params)))...);
+  }
+
+  // Invokes the implementation declared on `clazz` regardless of the runtime
+  // type of `object`, skipping virtual dispatch in the JVM.
+  template <typename... Params>
+  static ReturnProxied InvokeNonvirtual(jclass clazz, jobject object,
+                                        Params&&... params) {
+    static_assert(!IdT::kIsStatic && !IdT::kIsConstructor,
+                  "Only instance methods can be invoked non-virtually.");
+
+    return InvokeImpl<true, false>(clazz, OverloadRef::GetMethodID(clazz),
+                                   object, std::forward<Params>(params)...);
+  }
+
+  // As `InvokeNonvirtual`, but arguments are passed as a `jvalue` array.
+  template <typename... Params>
+  static ReturnProxied InvokeNonvirtualA(jclass clazz, jobject object,
+                                         Params&&... params) {
+    static_assert(!IdT::kIsStatic && !IdT::kIsConstructor,
+                  "Only instance methods can be invoked non-virtually.");
+
+    return InvokeImpl<true, true>(clazz, OverloadRef::GetMethodID(clazz),
+                                  object, std::forward<Params>(params)...);
+  }
+
+ private:
+  // Non-default loaders only, IDs without an `IdTable` slot by `jclass`.
+  static inline ClassKeyedMap<metaprogramming::DoubleLockedValue<jmethodID>>
+      class_keyed_ids_;
 };
 
 }  // namespace jni
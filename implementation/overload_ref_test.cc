@@ -16,18 +16,25 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
 #include "jni_bind.h"
 #include "jni_test.h"
 
 namespace {
 
+using ::jni::BoundMethod;
 using ::jni::Class;
+using ::jni::Extends;
+using ::jni::Fake;
 using ::jni::LocalObject;
 using ::jni::Method;
 using ::jni::Overload;
 using ::jni::Params;
+using ::jni::test::AsGlobal;
 using ::jni::test::JniTest;
 using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Return;
 using ::testing::StrEq;
 
 TEST_F(JniTest, MethodRef_AsksForCorrectMethods1) {
@@ -123,4 +130,62 @@ TEST_F(JniTest, MethodRef_AsksForCorrectMethodsWhenMultiplePresent4) {
   obj.Call<"Baz">(1234.f, 5678.f);
 }
 
+TEST_F(JniTest, MethodRef_InheritedMethodsAreResolvedOnceOnTheirAncestor) {
+  static constexpr Class kBase{
+      "com/google/Base",
+      Method{"Foo", jni::Return<void>{}, Params<jint>{}},
+  };
+  static constexpr Class kChild1{"com/google/Child1", Extends{kBase}};
+  static constexpr Class kChild2{"com/google/Child2", Extends{kBase}};
+  static constexpr Class kGrandchild{"com/google/Grandchild",
+                                     Extends{kChild1}};
+
+  EXPECT_CALL(*env_, FindClass).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(StrEq("com/google/Base")))
+      .WillOnce(Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), _)).Times(0);
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(1)), StrEq("Foo"),
+                                 StrEq("(I)V")))
+      .Times(1);
+
+  LocalObject<kChild1> child_1{};
+  LocalObject<kChild2> child_2{};
+  LocalObject<kGrandchild> grandchild{};
+
+  child_1.Call<"Foo">(1);
+  child_2.Call<"Foo">(2);
+  grandchild.Call<"Foo">(3);
+}
+
+TEST_F(JniTest, MethodRef_InheritedMethodsShareTheirAncestorsId) {
+  static constexpr Class kBase{
+      "com/google/Base",
+      Method{"Foo", jni::Return<void>{}, Params<jint>{}},
+  };
+  static constexpr Class kChild{"com/google/Child", Extends{kBase}};
+
+  EXPECT_CALL(*env_, FindClass).Times(AnyNumber());
+  EXPECT_CALL(*env_, FindClass(StrEq("com/google/Base")))
+      .WillOnce(Return(Fake<jclass>(1)));
+  EXPECT_CALL(*env_, DeleteGlobalRef).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID).Times(AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), _)).Times(0);
+  EXPECT_CALL(*env_, GetMethodID(AsGlobal(Fake<jclass>(1)), StrEq("Foo"),
+                                 StrEq("(I)V")))
+      .WillOnce(Return(Fake<jmethodID>(1)));
+
+  LocalObject<kBase> base{};
+  LocalObject<kChild> child{};
+
+  // Calls on the ancestor itself, bound methods and non-virtual calls all use
+  // the ancestor's ID.
+  base.Call<"Foo">(1);
+  child.Call<"Foo">(2);
+  child.CallNonvirtual<"Foo">(3);
+  BoundMethod<kChild, "Foo", jint> bound_foo;
+  bound_foo(child, 4);
+}
+
 }  // namespace
@@ -0,0 +1,308 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_PREWARM_H_
+#define JNI_BIND_IMPLEMENTATION_PREWARM_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "implementation/class_ref.h"
+#include "implementation/default_class_loader.h"
+#include "implementation/field_ref.h"
+#include "implementation/id.h"
+#include "implementation/id_type.h"
+#include "implementation/jni_helper/jni_helper.h"
+#include "implementation/jni_type.h"
+#include "implementation/jvm.h"
+#include "implementation/method_ancestry.h"
+#include "implementation/no_idx.h"
+#include "implementation/overload_ref.h"
+#include "implementation/signature.h"
+#include "implementation/startup_profile.h"
+#include "implementation/thread_guard.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// A member (or class) that could not be resolved by `Prewarm`.
+struct PrewarmFailure {
+  const char* class_name;
+
+  // Empty for the class itself.
+  const char* member_name;
+  const char* signature;
+};
+
+// A single ID to resolve. `warm` populates the same cache that a regular call
+// or field access would use and returns false if the ID could not be found.
+struct PrewarmTask {
+  const char* class_name;
+  const char* member_name;
+  const char* signature;
+  bool (*warm)(jclass);
+  jclass clazz;
+};
+
+// Enumerates every constructor, method overload, field, static method overload
+// and static field declared directly on `class_v`. Members of `Extends`
+// ancestors are not included, but calls to them through `class_v` use the IDs
+// prewarmed for the ancestor declaring them.
+template <const auto& class_v>
+struct PrewarmClassHelper {
+  using JniT_ = JniT<jobject, class_v, kDefaultClassLoader, kDefaultJvm>;
+
+  static constexpr auto& kClass = JniT_::stripped_class_v;
+  static constexpr auto& kStatic = JniT_::static_v;
+
+  template <typename IdT, IdType kReturnIdType>
+  static bool WarmMethod(jclass clazz) {
+    return OverloadRef<IdT, kReturnIdType>::GetMethodID(clazz) != nullptr;
+  }
+
+  template <IdType kFieldType, std::size_t I>
+  static bool WarmField(jclass clazz) {
+    return FieldRef<JniT_, kFieldType, I>::GetFieldID(clazz) != nullptr;
+  }
+
+  template <typename IdT, IdType kReturnIdType>
+  static void AddMethod(jclass clazz, std::vector<PrewarmTask>& tasks) {
+    tasks.push_back({kClass.name_, IdT::Name(), Signature_v<IdT>.data(),
+                     &WarmMethod<IdT, kReturnIdType>, clazz});
+  }
+
+  template <IdType kFieldType, std::size_t I>
+  static void AddField(jclass clazz, std::vector<PrewarmTask>& tasks) {
+    using IdT = typename FieldRef<JniT_, kFieldType, I>::IdT;
+
+    tasks.push_back({kClass.name_, IdT::Name(), Signature_v<IdT>.data(),
+                     &WarmField<kFieldType, I>, clazz});
+  }
+
+  template <std::size_t... Js>
+  static void AddConstructors(jclass clazz, std::vector<PrewarmTask>& tasks,
+                              std::index_sequence<Js...>) {
+    (AddMethod<Id<JniT_, IdType::OVERLOAD, kNoIdx, Js, kNoIdx, 0>,
+               IdType::OVERLOAD_PARAM>(clazz, tasks),
+     ...);
+  }
+
+  template <bool kIsStatic, std::size_t I, std::size_t... Js>
+  static void AddOverloads(jclass clazz, std::vector<PrewarmTask>& tasks,
+                           std::index_sequence<Js...>) {
+    if constexpr (kIsStatic) {
+      (AddMethod<Id<JniT_, IdType::STATIC_OVERLOAD, I, Js, kNoIdx, 0>,
+                 IdType::STATIC_OVERLOAD_PARAM>(clazz, tasks),
+       ...);
+    } else {
+      // The same IDs, and so cache slots, that calls to them resolve.
+      using OverloadSetIdT = MethodOverloadSetIdAt_t<JniT_, I>;
+
+      (AddMethod<typename OverloadSetIdT::template ChangeIdx<
+                     1, Js>::template ChangeIdType<IdType::OVERLOAD>,
+                 IdType::OVERLOAD_PARAM>(clazz, tasks),
+       ...);
+    }
+  }
+
+  template <bool kIsStatic, typename MethodsT, std::size_t... Is>
+  static void AddMethods(jclass clazz, std::vector<PrewarmTask>& tasks,
+                         const MethodsT& methods, std::index_sequence<Is...>) {
+    (AddOverloads<kIsStatic, Is>(
+         clazz, tasks,
+         std::make_index_sequence<std::tuple_size_v<
+             std::decay_t<decltype(std::get<Is>(methods).invocations_)>>>()),
+     ...);
+  }
+
+  template <IdType kFieldType, std::size_t... Is>
+  static void AddFields(jclass clazz, std::vector<PrewarmTask>& tasks,
+                        std::index_sequence<Is...>) {
+    (AddField<kFieldType, Is>(clazz, tasks), ...);
+  }
+
+  template <typename T>
+  static constexpr auto Indices(const T&) {
+    return std::make_index_sequence<std::tuple_size_v<T>>();
+  }
+
+  // Loads the class, returning false if it could not be found. Otherwise,
+  // appends a task for each of its members.
+  static bool AddTasks(std::vector<PrewarmTask>& tasks) {
+    jclass clazz = ClassRef_t<JniT_>::GetAndMaybeLoadClassRef(nullptr);
+    if (clazz == nullptr) {
+      return false;
+    }
+
+    AddConstructors(clazz, tasks, Indices(kClass.constructors_));
+    AddMethods<false>(clazz, tasks, kClass.methods_, Indices(kClass.methods_));
+    AddFields<IdType::FIELD>(clazz, tasks, Indices(kClass.fields_));
+    AddMethods<true>(clazz, tasks, kStatic.methods_, Indices(kStatic.methods_));
+    AddFields<IdType::STATIC_FIELD>(clazz, tasks, Indices(kStatic.fields_));
+
+    return true;
+  }
+};
+
+// Clears the exception a failed lookup (e.g. `NoSuchMethodError`) leaves pending.
+inline void ClearPrewarmException() {
+  if (JniHelper::ExceptionCheck()) {
+    JniHelper::ExceptionClear();
+  }
+}
+
+// Runs `tasks[i]` for every `i` handed out by `next`, recording failures.
+inline void RunPrewarmWorker(const std::vector<PrewarmTask>& tasks,
+                             std::atomic<std::size_t>& next,
+                             std::vector<PrewarmFailure>& failures,
+                             std::mutex& failures_lock) {
+  for (std::size_t i = next++; i < tasks.size(); i = next++) {
+    const PrewarmTask& task = tasks[i];
+
+    if (!task.warm(task.clazz)) {
+      ClearPrewarmException();
+
+      std::lock_guard<std::mutex> lock_guard{failures_lock};
+      failures.push_back({task.class_name, task.member_name, task.signature});
+    }
+  }
+}
+
+// Runs `tasks` on the calling thread or, if `num_threads` > 1, across that many
+// threads, each attached for the duration with a `ThreadGuard`.
+//
+// Tasks only resolve member IDs, each of which is stored in its own
+// `DoubleLockedValue` slot of an `IdTable` (or `RefStorage`). No shared list is
+// appended to: IDs are invalidated by `IdGeneration` rather than by walking a
+// registry, and the one registry that remains (`DefaultRefs<jclass>`) is only
+// appended to while classes load, on the calling thread, under
+// `DefaultRefsLock`. Anything added to a task must preserve this.
+inline void RunPrewarmTasks(const std::vector<PrewarmTask>& tasks,
+                            std::size_t num_threads,
+                            std::vector<PrewarmFailure>& failures) {
+  std::atomic<std::size_t> next{0};
+  std::mutex failures_lock;
+
+  if (num_threads <= 1) {
+    RunPrewarmWorker(tasks, next, failures, failures_lock);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&] {
+      ThreadGuard thread_guard{};
+      RunPrewarmWorker(tasks, next, failures, failures_lock);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+// Eagerly resolves the jclass and every method and field ID of each of
+// `class_vs`, populating the same caches that later calls and field accesses
+// read from. This moves the cost of first use (and contention on the ID
+// caches) to e.g. `JNI_OnLoad` rather than the first requests served.
+//
+// Classes are loaded on the calling thread. If `num_threads` > 1, member IDs
+// are then resolved across that many threads, each attached for the duration
+// with a `ThreadGuard`.
+//
+// Returns every class or member that could not be resolved (any pending
+// exception is cleared). Only classes using the default class loader are
+// supported.
+template <const auto&... class_vs>
+std::vector<PrewarmFailure> Prewarm(std::size_t num_threads = 1) {
+  std::vector<PrewarmFailure> failures;
+  std::vector<PrewarmTask> tasks;
+
+  (
+      [&] {
+        if (!PrewarmClassHelper<class_vs>::AddTasks(tasks)) {
+          ClearPrewarmException();
+          failures.push_back({class_vs.name_, "", ""});
+        }
+      }(),
+      ...);
+
+  RunPrewarmTasks(tasks, num_threads, failures);
+
+  return failures;
+}
+
+// Resolves exactly the classes and IDs listed in `profile`, as recorded by
+// `StartupProfile`. Keys that nothing in this binary resolves (e.g. from a
+// profile recorded by a different build) are skipped. Threading and failures
+// are as for `Prewarm`.
+inline std::vector<PrewarmFailure> ReplayStartupProfile(
+    std::string_view profile, std::size_t num_threads = 1) {
+  std::vector<PrewarmFailure> failures;
+  std::vector<PrewarmTask> tasks;
+
+  while (!profile.empty()) {
+    std::size_t end = profile.find('\n');
+    std::string_view key = profile.substr(0, end);
+    profile.remove_prefix(end == std::string_view::npos ? profile.size()
+                                                        : end + 1);
+
+    const StartupProfileEntry* entry = StartupProfile::Find(key);
+    if (entry == nullptr) {
+      continue;
+    }
+
+    jclass clazz = entry->load_class();
+    if (clazz == nullptr) {
+      ClearPrewarmException();
+      failures.push_back(
+          {entry->class_name, entry->member_name, entry->signature});
+    } else if (entry->warm != nullptr) {
+      tasks.push_back({entry->class_name, entry->member_name, entry->signature,
+                       entry->warm, clazz});
+    }
+  }
+
+  RunPrewarmTasks(tasks, num_threads, failures);
+
+  return failures;
+}
+
+// Reads a profile written by `StartupProfile::WriteToFile` and replays it. A
+// missing file resolves nothing.
+inline std::vector<PrewarmFailure> ReplayStartupProfileFromFile(
+    const char* path, std::size_t num_threads = 1) {
+  std::ifstream file{path, std::ios::binary};
+  std::stringstream profile;
+  profile << file.rdbuf();
+
+  return ReplayStartupProfile(profile.str(), num_threads);
+}
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_PREWARM_H_
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::Constructor;
+using ::jni::Fake;
+using ::jni::Field;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Overload;
+using ::jni::Params;
+using ::jni::Prewarm;
+using ::jni::PrewarmFailure;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::StaticRef;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::StrEq;
+
+static constexpr Class kClass{
+    "kClass",
+    Constructor<jint>{},
+    Static{
+        Method{"StaticFoo", Return<void>{}, Params<>{}},
+        Field{"staticField", jlong{}},
+    },
+    Method{"Foo", Overload{Return<jint>{}, Params<>{}},
+           Overload{Return<void>{}, Params<jint>{}}},
+    Field{"field", jfloat{}},
+};
+
+static constexpr Class kMissingMembersClass{
+    "kMissingMembersClass",
+    Method{"Present", Return<void>{}, Params<>{}},
+    Method{"Missing", Return<void>{}, Params<jint>{}},
+};
+
+static constexpr Class kThreadedClass{
+    "kThreadedClass",
+    Method{"A", Return<void>{}, Params<>{}},
+    Method{"B", Return<void>{}, Params<>{}},
+    Method{"C", Return<void>{}, Params<>{}},
+    Field{"d", jint{}},
+};
+
+TEST_F(JniTest, Prewarm_ResolvesEveryMemberOnce) {
+  EXPECT_CALL(*env_, FindClass(StrEq("kClass"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("<init>"), StrEq("(I)V"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("()I"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("(I)V"))).Times(1);
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("field"), StrEq("F"))).Times(1);
+  EXPECT_CALL(*env_, GetStaticMethodID(_, StrEq("StaticFoo"), StrEq("()V")))
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+  EXPECT_CALL(*env_, GetStaticFieldID(_, StrEq("staticField"), StrEq("J")))
+      .WillOnce(testing::Return(Fake<jfieldID>(2)));
+
+  EXPECT_TRUE((Prewarm<kClass>().empty()));
+
+  // Subsequent use reads the cached IDs.
+  LocalObject<kClass> obj{1};
+  obj.Call<"Foo">();
+  obj.Call<"Foo">(1);
+  obj.Access<"field">().Get();
+  StaticRef<kClass>{}.Call<"StaticFoo">();
+  StaticRef<kClass>{}.Access<"staticField">().Get();
+}
+
+TEST_F(JniTest, Prewarm_ReportsAndClearsFailures) {
+  EXPECT_CALL(*env_, GetMethodID).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Missing"), StrEq("(I)V")))
+      .WillOnce(testing::Return(nullptr));
+  EXPECT_CALL(*env_, ExceptionCheck).WillOnce(testing::Return(JNI_TRUE));
+  EXPECT_CALL(*env_, ExceptionClear).Times(1);
+
+  std::vector<PrewarmFailure> failures =
+      default_jvm_ref_->Prewarm<kMissingMembersClass>();
+
+  ASSERT_EQ(failures.size(), 1);
+  EXPECT_STREQ(failures[0].class_name, "kMissingMembersClass");
+  EXPECT_STREQ(failures[0].member_name, "Missing");
+  EXPECT_STREQ(failures[0].signature, "(I)V");
+}
+
+TEST_F(JniTest, Prewarm_ResolvesAcrossThreads) {
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("<init>"), _)).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("A"), _)).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("B"), _)).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("C"), _)).Times(1);
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("d"), _)).Times(1);
+
+  EXPECT_TRUE((Prewarm<kThreadedClass>(3).empty()));
+
+  // Every ID resolved on a worker thread is visible to this one.
+  LocalObject<kThreadedClass> obj{};
+  obj.Call<"A">();
+  obj.Call<"B">();
+  obj.Call<"C">();
+  obj.Access<"d">().Get();
+}
+
+}  // namespace
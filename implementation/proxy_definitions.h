@@ -23,6 +23,7 @@
 #include <tuple>
 #include <type_traits>
 
+#include "class_defs/java_nio_classes.h"
 #include "implementation/forward_declarations.h"
 #include "implementation/id_type.h"
 #include "implementation/jni_helper/lifecycle.h"
@@ -154,6 +155,14 @@ struct Proxy<JObject,
         std::string_view{class_v.name_} == std::string_view{IdT::Val().name_};
   };
 
+  // `DirectByteBuffer` form.
+  template <typename IdT>
+  struct ContextualViabilityHelper<IdT, DirectByteBuffer> {
+    static constexpr bool kViable =
+        std::string_view{kJavaNioByteBuffer.name_} ==
+        std::string_view{IdT::Val().name_};
+  };
+
   template <typename IdT, typename T>
   static constexpr bool kViable = ContextualViabilityHelper<IdT, T>::kViable;
 
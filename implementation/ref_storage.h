@@ -19,7 +19,10 @@
 
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <mutex>
 #include <vector>
 
 #include "metaprogramming/double_locked_value.h"
@@ -29,7 +32,7 @@ namespace jni {
 
 // Used as shared storage of lists for IDs like jclass, jMethod, etc.
 // Only applicable for Jvms not fully specified (i.e. default classloader).
-// See JvmRef::~JvmRef.
+// Appends and teardown are guarded by `DefaultRefsLock`. See JvmRef::~JvmRef.
 template <typename T>
 static std::vector<metaprogramming::DoubleLockedValue<T>*>& DefaultRefs() {
   static auto* ret_val =
@@ -37,6 +40,21 @@ static std::vector<metaprogramming::DoubleLockedValue<T>*>& DefaultRefs() {
   return *ret_val;
 }
 
+template <typename T>
+static std::mutex& DefaultRefsLock() {
+  static auto* ret_val = new std::mutex{};
+  return *ret_val;
+}
+
+// Generation that cached IDs of type `T` are stored against. Advancing it
+// invalidates every such ID at once, and each re-resolves on its next use.
+// See JvmRef::~JvmRef.
+template <typename T>
+inline std::atomic<std::uint32_t>& IdGeneration() {
+  static std::atomic<std::uint32_t> generation{0};
+  return generation;
+}
+
 // Provides a static inline `DoubleLockedValue<T>` val against a `UniqueID`.
 template <typename UniqueID, typename T>
 struct StaticDoubleLock {
@@ -59,10 +77,11 @@ struct RefStorage {
   // Common ID-wide double locked value.
   using Storage = StaticDoubleLock<Signature, ReturnT>;
 
-  // Retrieves the guarded value, possibly invoking the expensive lambda.
-  static ReturnT Get(GetLambda lambda) {
+  // Retrieves the guarded value, possibly invoking the expensive lambda if
+  // the value is unset or was stored against a different `generation`.
+  static ReturnT Get(GetLambda lambda, std::uint32_t generation = 0) {
     return StaticDoubleLock<Signature, ReturnT>::val.LoadAndMaybeInit(
-        std::bind(lambda, &Storage::val));
+        std::bind(lambda, &Storage::val), generation);
   }
 };
 
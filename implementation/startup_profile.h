@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_STARTUP_PROFILE_H_
+#define JNI_BIND_IMPLEMENTATION_STARTUP_PROFILE_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "jni_dep.h"
+
+namespace jni {
+
+// An ID that can be resolved again from a startup profile. `warm` is null for
+// classes, which are resolved by `load_class` alone.
+struct StartupProfileEntry {
+  const char* class_name;
+  const char* member_name;
+  const char* signature;
+  jclass (*load_class)();
+  bool (*warm)(jclass);
+};
+
+// Records which classes, methods and fields a process resolves so that a later
+// process can resolve the same working set before it is first used (see
+// `ReplayStartupProfile`).
+//
+// Every class, method and field ID cache that is instantiated for the default
+// class loader registers itself here during static initialisation under a key
+// of the form "class#member#signature". While recording, each cache miss that
+// resolves successfully appends its key to the profile, once. A profile is
+// newline separated keys in the order they were first resolved.
+class StartupProfile {
+ public:
+  static void StartRecording() {
+    recording_.store(true, std::memory_order_release);
+  }
+
+  static void StopRecording() {
+    recording_.store(false, std::memory_order_release);
+  }
+
+  // Discards everything recorded so far.
+  static void Clear() {
+    std::lock_guard<std::mutex> lock_guard{Lock()};
+    Recorded().clear();
+    RecordedKeys().clear();
+  }
+
+  // Invoked from cache miss paths, this is a cheap load unless recording.
+  // A key is only recorded the first time it is resolved, IDs resolved again
+  // after a teardown are not repeated.
+  static void MaybeRecord(std::string_view key) {
+    if (!recording_.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock_guard{Lock()};
+    if (RecordedKeys().emplace(key).second) {
+      Recorded().emplace_back(key);
+    }
+  }
+
+  // Returns the profile recorded so far.
+  static std::string Serialize() {
+    std::lock_guard<std::mutex> lock_guard{Lock()};
+
+    std::string ret;
+    for (const std::string& key : Recorded()) {
+      ret.append(key);
+      ret.push_back('\n');
+    }
+
+    return ret;
+  }
+
+  // Writes the profile recorded so far to `path`, returning false on failure.
+  static bool WriteToFile(const char* path) {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    file << Serialize();
+
+    return static_cast<bool>(file);
+  }
+
+  static bool Register(std::string_view key, const StartupProfileEntry& entry) {
+    std::lock_guard<std::mutex> lock_guard{Lock()};
+    Registry().emplace(key, entry);
+
+    return true;
+  }
+
+  // Returns the entry registered for `key`, or null if nothing in this binary
+  // resolves it (e.g. the profile was recorded by a different build).
+  static const StartupProfileEntry* Find(std::string_view key) {
+    std::lock_guard<std::mutex> lock_guard{Lock()};
+    auto it = Registry().find(key);
+
+    return it == Registry().end() ? nullptr : &it->second;
+  }
+
+ private:
+  static std::mutex& Lock() {
+    static auto* ret_val = new std::mutex{};
+    return *ret_val;
+  }
+
+  static std::vector<std::string>& Recorded() {
+    static auto* ret_val = new std::vector<std::string>{};
+    return *ret_val;
+  }
+
+  // The keys of `Recorded()`, to de-duplicate them.
+  static std::set<std::string, std::less<>>& RecordedKeys() {
+    static auto* ret_val = new std::set<std::string, std::less<>>{};
+    return *ret_val;
+  }
+
+  static std::map<std::string_view, StartupProfileEntry, std::less<>>&
+  Registry() {
+    static auto* ret_val =
+        new std::map<std::string_view, StartupProfileEntry, std::less<>>{};
+    return *ret_val;
+  }
+
+  static inline std::atomic<bool> recording_ = false;
+};
+
+// Registers `T::ProfileEntry()` under `T::kProfileKey` during static
+// initialisation of any binary that odr-uses `kRegistered`.
+template <typename T>
+struct StartupProfileRegistration {
+  static inline const bool kRegistered =
+      StartupProfile::Register(T::kProfileKey, T::ProfileEntry());
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_STARTUP_PROFILE_H_
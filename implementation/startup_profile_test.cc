@@ -0,0 +1,202 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "implementation/jni_helper/fake_test_constants.h"
+#include "jni_bind.h"
+#include "jni_test.h"
+
+namespace {
+
+using ::jni::Class;
+using ::jni::Extends;
+using ::jni::Fake;
+using ::jni::Field;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::PrewarmFailure;
+using ::jni::ReplayStartupProfile;
+using ::jni::ReplayStartupProfileFromFile;
+using ::jni::Return;
+using ::jni::Static;
+using ::jni::StartupProfile;
+using ::jni::StaticRef;
+using ::jni::test::JniTest;
+using ::testing::_;
+using ::testing::HasSubstr;
+using ::testing::Not;
+using ::testing::StrEq;
+
+static constexpr Class kRecordedClass{
+    "kRecordedClass",
+    Static{Method{"StaticFoo", Return<void>{}, Params<>{}}},
+    Method{"Foo", Return<jint>{}, Params<>{}},
+    Field{"field", jfloat{}},
+};
+
+static constexpr Class kRecordedChild{"kRecordedChild",
+                                      Extends{kRecordedClass}};
+
+static constexpr Class kReplayedClass{
+    "kReplayedClass",
+    Method{"Foo", Return<jint>{}, Params<jint>{}},
+    Method{"Bar", Return<void>{}, Params<>{}},
+    Field{"field", jlong{}},
+};
+
+static constexpr Class kMissingClass{
+    "kMissingClass",
+    Method{"Foo", Return<void>{}, Params<>{}},
+};
+
+TEST_F(JniTest, StartupProfile_RecordsResolvedIdsInOrder) {
+  EXPECT_CALL(*env_, GetStaticMethodID)
+      .WillOnce(testing::Return(Fake<jmethodID>(2)));
+
+  StartupProfile::Clear();
+  StartupProfile::StartRecording();
+
+  LocalObject<kRecordedClass> obj{Fake<jobject>()};
+  obj.Call<"Foo">();
+  obj.Call<"Foo">();
+  obj.Access<"field">().Get();
+  StaticRef<kRecordedClass>{}.Call<"StaticFoo">();
+
+  StartupProfile::StopRecording();
+
+  EXPECT_EQ(StartupProfile::Serialize(),
+            "kRecordedClass\n"
+            "kRecordedClass#Foo#()I\n"
+            "kRecordedClass#field#F\n"
+            "kRecordedClass#StaticFoo#()V\n");
+}
+
+TEST_F(JniTest, StartupProfile_RecordsEachKeyOnce) {
+  StartupProfile::Clear();
+  StartupProfile::StartRecording();
+
+  // e.g. an ID resolved again after its generation is invalidated.
+  StartupProfile::MaybeRecord("kRecordedClass#Foo#()I");
+  StartupProfile::MaybeRecord("kRecordedClass");
+  StartupProfile::MaybeRecord("kRecordedClass#Foo#()I");
+
+  EXPECT_EQ(StartupProfile::Serialize(),
+            "kRecordedClass#Foo#()I\n"
+            "kRecordedClass\n");
+
+  // Cleared keys are recorded again.
+  StartupProfile::Clear();
+  StartupProfile::MaybeRecord("kRecordedClass#Foo#()I");
+  StartupProfile::StopRecording();
+
+  EXPECT_EQ(StartupProfile::Serialize(), "kRecordedClass#Foo#()I\n");
+}
+
+TEST_F(JniTest, StartupProfile_RecordsInheritedMethodsUnderTheirAncestor) {
+  StartupProfile::Clear();
+  StartupProfile::StartRecording();
+
+  LocalObject<kRecordedChild> obj{Fake<jobject>()};
+  obj.Call<"Foo">();
+
+  StartupProfile::StopRecording();
+
+  // Replaying the ancestor's entry resolves the ID the child's calls use.
+  EXPECT_THAT(StartupProfile::Serialize(),
+              HasSubstr("kRecordedClass#Foo#()I\n"));
+  EXPECT_THAT(StartupProfile::Serialize(), Not(HasSubstr("kRecordedChild#")));
+}
+
+TEST_F(JniTest, StartupProfile_DoesNotRecordUnlessRecording) {
+  StartupProfile::Clear();
+
+  LocalObject<kRecordedClass> obj{Fake<jobject>()};
+  obj.Call<"Foo">();
+
+  EXPECT_EQ(StartupProfile::Serialize(), "");
+}
+
+TEST_F(JniTest, StartupProfile_ReplayResolvesOnlyTheRecordedWorkingSet) {
+  EXPECT_CALL(*env_, FindClass(StrEq("kReplayedClass"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), StrEq("(I)I"))).Times(1);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Bar"), _)).Times(0);
+  EXPECT_CALL(*env_, GetFieldID(_, StrEq("field"), StrEq("J"))).Times(1);
+
+  EXPECT_TRUE(ReplayStartupProfile("kReplayedClass\n"
+                                   "kReplayedClass#Foo#(I)I\n"
+                                   "kReplayedClass#field#J\n"
+                                   "kNotBoundInThisBinary#foo#()V\n",
+                                   2)
+                  .empty());
+
+  // Already resolved, so no further lookups.
+  LocalObject<kReplayedClass> obj{Fake<jobject>()};
+  obj.Call<"Foo">(1);
+  obj.Access<"field">().Get();
+
+  if (false) {
+    obj.Call<"Bar">();
+  }
+}
+
+TEST_F(JniTest, StartupProfile_ReplayReportsClassesThatFailToLoad) {
+  EXPECT_CALL(*env_, FindClass(StrEq("kMissingClass")))
+      .WillRepeatedly(testing::Return(nullptr));
+  EXPECT_CALL(*env_, NewGlobalRef(nullptr))
+      .WillRepeatedly(testing::Return(nullptr));
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), _)).Times(0);
+
+  std::vector<PrewarmFailure> failures =
+      ReplayStartupProfile("kMissingClass#Foo#()V\n");
+
+  ASSERT_EQ(failures.size(), 1);
+  EXPECT_STREQ(failures[0].class_name, "kMissingClass");
+  EXPECT_STREQ(failures[0].member_name, "Foo");
+  EXPECT_STREQ(failures[0].signature, "()V");
+
+  if (false) {
+    LocalObject<kMissingClass>{Fake<jobject>()}.Call<"Foo">();
+  }
+}
+
+TEST_F(JniTest, StartupProfile_RoundTripsThroughFile) {
+  const std::string path = testing::TempDir() + "/startup_profile";
+
+  StartupProfile::Clear();
+  StartupProfile::StartRecording();
+  LocalObject<kRecordedClass>{Fake<jobject>()}.Call<"Foo">();
+  StartupProfile::StopRecording();
+  ASSERT_TRUE(StartupProfile::WriteToFile(path.c_str()));
+
+  std::ifstream file{path};
+  std::stringstream contents;
+  contents << file.rdbuf();
+  EXPECT_EQ(contents.str(), "kRecordedClass\nkRecordedClass#Foo#()I\n");
+
+  // Everything in the profile is already resolved.
+  EXPECT_CALL(*env_, FindClass(StrEq("kRecordedClass"))).Times(0);
+  EXPECT_CALL(*env_, GetMethodID(_, StrEq("Foo"), _)).Times(0);
+  EXPECT_TRUE(default_jvm_ref_->ReplayStartupProfile(path.c_str()).empty());
+}
+
+}  // namespace
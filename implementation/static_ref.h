@@ -20,6 +20,9 @@
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
 #include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "implementation/class_ref.h"
 #include "implementation/default_class_loader.h"
@@ -33,6 +36,7 @@
 #include "jni_dep.h"
 #include "metaprogramming/invocable_map.h"
 #include "metaprogramming/invocable_map_20.h"
+#include "metaprogramming/modified_max.h"
 #include "metaprogramming/queryable_map.h"
 #include "metaprogramming/queryable_map_20.h"
 #include "metaprogramming/string_literal.h"
@@ -155,6 +159,32 @@ struct StaticRef
         GetJClass(), nullptr, std::forward<Args>(args)...);
   }
 
+  // Like `Call`, but arguments are passed to the JVM as a `jvalue` array
+  // (`CallStatic<Type>MethodA`) rather than as C varargs.
+  template <metaprogramming::StringLiteral key_literal, typename... Args>
+  auto CallA(Args&&... args) const {
+    using MethodsT = std::decay_t<decltype(_JniT::static_v.methods_)>;
+    using MethodMap20T =
+        StaticRefHelperMethodMap20_t<StaticRef, class_v_, class_loader_v_,
+                                     jvm_v_>;
+
+    constexpr std::size_t I = MethodMap20T::SelectCandidate(
+        key_literal, std::make_index_sequence<std::tuple_size_v<MethodsT>>());
+    static_assert(I != metaprogramming::kNegativeOne,
+                  "JNI Error: No method with this name.");
+
+    using IdT = Id<_JniT, IdType::STATIC_OVERLOAD_SET, I, kNoIdx, kNoIdx, 0>;
+    using MethodSelectionForArgs =
+        OverloadSelector<IdT, IdType::STATIC_OVERLOAD,
+                         IdType::STATIC_OVERLOAD_PARAM, Args...>;
+
+    static_assert(MethodSelectionForArgs::kIsValidArgSet,
+                  "JNI Error: Invalid argument set.");
+
+    return MethodSelectionForArgs::_OverloadRef::InvokeA(
+        GetJClass(), nullptr, std::forward<Args>(args)...);
+  }
+
   // Invoked through CRTP from QueryableMap20, C++20 only.
   template <size_t I, metaprogramming::StringLiteral key_literal>
   auto QueryableMap20Call() const {
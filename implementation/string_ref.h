@@ -20,6 +20,7 @@
 // IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
 
 #include <cstddef>
+#include <string>
 #include <string_view>
 
 #include "jni_helper/jni_helper.h"
@@ -111,6 +112,29 @@ class UtfString {
   const std::string string_;
 };
 
+// Copies the contents of `java_string` to an std::string with a single copy.
+//
+// Unlike `UtfString`, this sizes the destination with `GetStringUTFLength` and
+// copies directly into it with `GetStringUTFRegion`, so the characters are
+// never pinned and no intermediate buffer is allocated.
+inline std::string CopyToStdString(jstring java_string) {
+  if (!java_string) {
+    return {};
+  }
+
+  std::string ret(
+      static_cast<std::size_t>(JniHelper::GetStringUTFLength(java_string)),
+      '\0');
+
+  // The region call may write a terminator at `ret[ret.size()]`, which is
+  // permitted as it is always '\0'.
+  JniHelper::GetStringUTFRegion(java_string, 0,
+                                JniHelper::GetStringLength(java_string),
+                                ret.data());
+
+  return ret;
+}
+
 }  // namespace jni
 
 #endif  // JNI_BIND_STRING_REF_H_
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cstring>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -27,6 +28,7 @@
 namespace {
 
 using ::jni::AdoptGlobal;
+using ::jni::AdoptLocal;
 using ::jni::Fake;
 using ::jni::GlobalObject;
 using ::jni::GlobalString;
@@ -164,6 +166,44 @@ TEST_F(JniTest, LocalString_PinsAndUnpinsMemoryAsStdStringForLocals) {
   EXPECT_EQ(utf_string.ToString(), char_ptr);
 }
 
+TEST_F(JniTest, LocalString_CopiesAsStdStringWithoutPinning) {
+  jstring local_jstring = Fake<jstring>();
+
+  EXPECT_CALL(*env_, GetStringUTFChars).Times(0);
+  EXPECT_CALL(*env_, GetStringUTFLength(local_jstring)).WillOnce(Return(3));
+  EXPECT_CALL(*env_, GetStringLength(local_jstring)).WillOnce(Return(3));
+  EXPECT_CALL(*env_, GetStringUTFRegion(local_jstring, 0, 3, _))
+      .WillOnce([](jstring, jsize, jsize, char* buf) {
+        std::memcpy(buf, "abc", 4);
+      });
+  EXPECT_CALL(*env_, DeleteLocalRef(local_jstring));
+
+  LocalString str{AdoptLocal{}, local_jstring};
+  EXPECT_EQ(str.AsStdString(), "abc");
+}
+
+TEST_F(JniTest, LocalString_AsStdStringDeletesRValuesImmediately) {
+  jstring returned_jstring = Fake<jstring>(2);
+
+  EXPECT_CALL(*env_, CallObjectMethodV).WillOnce(Return(returned_jstring));
+  EXPECT_CALL(*env_, GetStringUTFLength(returned_jstring))
+      .WillOnce(Return(0));
+  EXPECT_CALL(*env_, GetStringLength(returned_jstring)).WillOnce(Return(0));
+  EXPECT_CALL(*env_, GetStringUTFRegion(returned_jstring, 0, 0, _));
+  EXPECT_CALL(*env_, DeleteLocalRef).Times(testing::AnyNumber());
+  EXPECT_CALL(*env_, DeleteLocalRef(returned_jstring)).Times(1);
+
+  LocalObject<kClass> obj{Fake<jobject>()};
+  EXPECT_EQ(obj.Call<"Foo">().AsStdString(), "");
+}
+
+TEST_F(JniTest, LocalString_AsStdStringOfNullIsEmpty) {
+  EXPECT_CALL(*env_, GetStringUTFLength).Times(0);
+  EXPECT_CALL(*env_, GetStringUTFRegion).Times(0);
+
+  EXPECT_TRUE(LocalString{nullptr}.AsStdString().empty());
+}
+
 TEST_F(JniTest, LocalString_AllowsLValueLocalString) {
   LocalObject<kClass> obj{};
   LocalString local_string{"abcde"};
@@ -256,6 +296,24 @@ TEST_F(JniTest, GlobalString_PinsAndUnpinsMemoryAsStdStringForLocals) {
   EXPECT_EQ(utf_string.ToString(), char_ptr);
 }
 
+TEST_F(JniTest, GlobalString_CopiesAsStdStringWithoutPinning) {
+  jstring faked_global_jstring = Fake<jstring>();
+
+  EXPECT_CALL(*env_, GetStringUTFChars).Times(0);
+  EXPECT_CALL(*env_, GetStringUTFLength(faked_global_jstring))
+      .WillOnce(Return(2));
+  EXPECT_CALL(*env_, GetStringLength(faked_global_jstring))
+      .WillOnce(Return(2));
+  EXPECT_CALL(*env_, GetStringUTFRegion(faked_global_jstring, 0, 2, _))
+      .WillOnce([](jstring, jsize, jsize, char* buf) {
+        std::memcpy(buf, "hi", 2);
+      });
+  EXPECT_CALL(*env_, DeleteLocalRef(_)).Times(0);
+
+  GlobalString str{AdoptGlobal{}, faked_global_jstring};
+  EXPECT_EQ(str.AsStdString(), "hi");
+}
+
 TEST_F(JniTest, GlobalString_AllowsLValueGlobalString) {
   LocalObject<kClass> obj{};
   GlobalString global_string{"abcde"};
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JNI_BIND_IMPLEMENTATION_TRACKED_ARRAY_VIEW_H_
+#define JNI_BIND_IMPLEMENTATION_TRACKED_ARRAY_VIEW_H_
+
+// IWYU pragma: private, include "third_party/jni_wrapper/jni_bind.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "implementation/jni_helper/get_array_element_result.h"
+#include "implementation/jni_helper/jni_array_helper.h"
+#include "jni_dep.h"
+
+namespace jni {
+
+// Past this many disjoint written ranges, or once more than half of the array
+// has been written, a `TrackedArrayView` copies the whole array back in one
+// release rather than issue a `Set<Type>ArrayRegion` per range.
+inline constexpr std::size_t kTrackedArrayMaxRanges = 16;
+
+// A writable view of a primitive array that only copies back what was written.
+//
+// Reads go through `ptr()` (or iteration) as with `ArrayView`, but writes must
+// go through `Set` or `MutableRange` so that they are recorded. On destruction
+// the written ranges are coalesced and copied back with `Set<Type>ArrayRegion`
+// and the buffer is released with `JNI_ABORT`, so a view that is mostly read
+// pays for only the elements it changed (see `kTrackedArrayMaxRanges`).
+//
+//   TrackedArrayView<jint> view = arr.PinTracked();
+//   view.Set(3, view.ptr()[3] + 1);  // Only element 3 is copied back.
+template <typename SpanType>
+class TrackedArrayView {
+ public:
+  TrackedArrayView(TrackedArrayView&&) = delete;
+  TrackedArrayView(const TrackedArrayView&) = delete;
+
+  TrackedArrayView(jarray array, std::size_t size)
+      : array_(array),
+        get_array_elements_result_(
+            JniArrayHelper<SpanType, 1>::GetArrayElements(array)),
+        size_(size) {}
+
+  ~TrackedArrayView() {
+    SpanType* ptr = get_array_elements_result_.ptr_;
+
+    // If the VM didn't copy, writes already landed in the array.
+    if (!get_array_elements_result_.is_copy) {
+      JniArrayHelper<SpanType, 1>::ReleaseArrayElements(array_, ptr, false);
+      return;
+    }
+
+    const auto ranges = CoalescedDirtyRanges();
+
+    std::size_t dirty_elements = 0;
+    for (const auto& [begin, end] : ranges) {
+      dirty_elements += end - begin;
+    }
+
+    // Many small copies cost more than one full one.
+    if (ranges.size() > kTrackedArrayMaxRanges ||
+        dirty_elements > size_ / 2) {
+      JniArrayHelper<SpanType, 1>::ReleaseArrayElements(array_, ptr, true);
+      return;
+    }
+
+    for (const auto& [begin, end] : ranges) {
+      JniArrayHelper<SpanType, 1>::SetArrayRegion(array_, begin, end - begin,
+                                                  ptr + begin);
+    }
+
+    JniArrayHelper<SpanType, 1>::ReleaseArrayElements(array_, ptr, false);
+  }
+
+  const SpanType* ptr() const { return get_array_elements_result_.ptr_; }
+  const SpanType* data() const { return get_array_elements_result_.ptr_; }
+  std::size_t size() const { return size_; }
+
+  const SpanType* begin() const { return ptr(); }
+  const SpanType* end() const { return ptr() + size_; }
+
+  void Set(std::size_t idx, SpanType val) {
+    assert(idx < size_);
+    get_array_elements_result_.ptr_[idx] = val;
+    MarkDirty(idx, 1);
+  }
+
+  // Returns `len` writable elements starting at `offset`, all of which will be
+  // copied back.
+  SpanType* MutableRange(std::size_t offset, std::size_t len) {
+    assert(offset <= size_ && len <= size_ - offset);
+    MarkDirty(offset, len);
+    return get_array_elements_result_.ptr_ + offset;
+  }
+
+ private:
+  void MarkDirty(std::size_t offset, std::size_t len) {
+    if (len == 0) {
+      return;
+    }
+
+    // Repeated or sequential writes extend the last range in place.
+    if (!dirty_ranges_.empty()) {
+      auto& [begin, end] = dirty_ranges_.back();
+      if (offset >= begin && offset <= end) {
+        end = std::max(end, offset + len);
+        return;
+      }
+    }
+
+    dirty_ranges_.emplace_back(offset, offset + len);
+  }
+
+  // Sorted, non-overlapping, non-adjacent [begin, end) ranges.
+  std::vector<std::pair<std::size_t, std::size_t>> CoalescedDirtyRanges() {
+    std::sort(dirty_ranges_.begin(), dirty_ranges_.end());
+
+    std::vector<std::pair<std::size_t, std::size_t>> ret;
+    for (const auto& range : dirty_ranges_) {
+      if (!ret.empty() && range.first <= ret.back().second) {
+        ret.back().second = std::max(ret.back().second, range.second);
+      } else {
+        ret.push_back(range);
+      }
+    }
+
+    return ret;
+  }
+
+  const jarray array_;
+  const GetArrayElementsResult<SpanType> get_array_elements_result_;
+  const std::size_t size_;
+
+  // Unmerged [begin, end) ranges written through `Set` or `MutableRange`.
+  std::vector<std::pair<std::size_t, std::size_t>> dirty_ranges_;
+};
+
+}  // namespace jni
+
+#endif  // JNI_BIND_IMPLEMENTATION_TRACKED_ARRAY_VIEW_H_
@@ -0,0 +1,300 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+package com.jnibind;
+
+import static java.lang.invoke.MethodType.methodType;
+
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Method;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Executes a batch of calls recorded by {@code jni::Batch} in a single JNI transition.
+ *
+ * <p>{@code descriptors} is a space separated table of method names immediately followed by their
+ * JNI signatures (e.g. "setOne(I)V "), listing every method overload of a {@code jni::Class}
+ * definition. Each op in {@code buffer} is a 2 byte index into this table followed by the method's
+ * arguments at their natural width. Results of methods returning a primitive are written, in op
+ * order, to 8 byte slots starting at the first 8 byte aligned offset after the ops. All values are
+ * in native byte order.
+ *
+ * <p>Each method is adapted once into a {@link MethodHandle} that reads its arguments from, and
+ * writes its result to, the buffer, so executing an op neither boxes nor reflects.
+ */
+public final class BatchExecutor {
+  private static final int RESULT_SLOT_SIZE = 8;
+
+  private static final MethodHandles.Lookup LOOKUP = MethodHandles.lookup();
+
+  /** The type every op is adapted to: (target, buffer, argsPosition, resultPosition). */
+  private static final MethodType OP_TYPE =
+      methodType(void.class, Object.class, ByteBuffer.class, int.class, int.class);
+
+  private static final MethodHandle ADD;
+  private static final MethodHandle GET_BOOLEAN;
+  private static final MethodHandle PUT_BOOLEAN;
+
+  static {
+    try {
+      ADD =
+          LOOKUP.findStatic(
+              BatchExecutor.class, "add", methodType(int.class, int.class, int.class));
+      GET_BOOLEAN =
+          LOOKUP.findStatic(
+              BatchExecutor.class,
+              "getBoolean",
+              methodType(boolean.class, ByteBuffer.class, int.class));
+      PUT_BOOLEAN =
+          LOOKUP.findStatic(
+              BatchExecutor.class,
+              "putBoolean",
+              methodType(void.class, ByteBuffer.class, int.class, boolean.class));
+    } catch (ReflectiveOperationException e) {
+      throw new ExceptionInInitializerError(e);
+    }
+  }
+
+  /**
+   * Resolved descriptor tables, keyed by the class they were resolved against and then by the
+   * table. A table is fixed by its {@code jni::Class} definition, so there is one per definition.
+   */
+  private static final ClassValue<ConcurrentHashMap<String, Op[]>> opTables =
+      new ClassValue<ConcurrentHashMap<String, Op[]>>() {
+        @Override
+        protected ConcurrentHashMap<String, Op[]> computeValue(Class<?> clazz) {
+          return new ConcurrentHashMap<>();
+        }
+      };
+
+  private BatchExecutor() {}
+
+  public static void execute(Object target, String descriptors, ByteBuffer buffer, int length)
+      throws Throwable {
+    Class<?> clazz = target.getClass();
+    Op[] ops = opTables.get(clazz).computeIfAbsent(descriptors, d -> resolve(clazz, d));
+
+    buffer.order(ByteOrder.nativeOrder());
+    int position = 0;
+    int resultPosition = (length + RESULT_SLOT_SIZE - 1) / RESULT_SLOT_SIZE * RESULT_SLOT_SIZE;
+
+    while (position < length) {
+      int index = Short.toUnsignedInt(buffer.getShort(position));
+      Op op = ops[index];
+      if (op == null) {
+        throw new IllegalArgumentException(
+            "Cannot batch " + descriptors.split(" ")[index] + " on " + clazz.getName());
+      }
+
+      op.invoker.invokeExact(target, buffer, position + 2, resultPosition);
+
+      position += op.size;
+      if (op.hasResult) {
+        resultPosition += RESULT_SLOT_SIZE;
+      }
+    }
+  }
+
+  private static final class Op {
+    /** The method adapted to {@link #OP_TYPE}. */
+    final MethodHandle invoker;
+
+    /** Encoded size of the op, including its index. */
+    final int size;
+
+    final boolean hasResult;
+
+    Op(Method method) throws ReflectiveOperationException {
+      Class<?>[] params = method.getParameterTypes();
+      Class<?> returnType = method.getReturnType();
+
+      // (Object, p0, ..., pn)R.
+      MethodHandle handle = LOOKUP.unreflect(method);
+      handle = handle.asType(handle.type().changeParameterType(0, Object.class));
+
+      // Each parameter is replaced by a read at its offset, giving
+      // (Object, ByteBuffer, int, ..., ByteBuffer, int)R, and the buffer and position are then
+      // shared by every read, giving (Object, ByteBuffer, int)R.
+      int[] reorder = new int[1 + 2 * params.length];
+      int offset = 0;
+      for (int i = 0; i < params.length; ++i) {
+        handle = MethodHandles.collectArguments(handle, 1 + 2 * i, reader(params[i], offset));
+        reorder[1 + 2 * i] = 1;
+        reorder[2 + 2 * i] = 2;
+        offset += sizeOf(params[i]);
+      }
+      handle =
+          MethodHandles.permuteArguments(
+              handle, methodType(returnType, Object.class, ByteBuffer.class, int.class), reorder);
+
+      hasResult = returnType.isPrimitive() && returnType != void.class;
+      if (hasResult) {
+        // (ByteBuffer, int, Object, ByteBuffer, int)void, reordered to OP_TYPE.
+        handle = MethodHandles.collectArguments(writer(returnType), 2, handle);
+        handle = MethodHandles.permuteArguments(handle, OP_TYPE, 1, 3, 0, 1, 2);
+      } else {
+        // Self results are discarded, the target is already held by the caller.
+        handle = handle.asType(handle.type().changeReturnType(void.class));
+        handle = MethodHandles.dropArguments(handle, 3, int.class);
+      }
+
+      this.invoker = handle;
+      this.size = 2 + offset;
+    }
+  }
+
+  private static Op[] resolve(Class<?> clazz, String descriptors) {
+    String[] entries = descriptors.trim().split(" ");
+    Op[] ops = new Op[entries.length];
+
+    for (int i = 0; i < entries.length; ++i) {
+      ops[i] = resolveOp(clazz, entries[i]);
+    }
+
+    return ops;
+  }
+
+  /** Returns null for methods that cannot be batched or are not found. */
+  private static Op resolveOp(Class<?> clazz, String entry) {
+    int paramsStart = entry.indexOf('(');
+    int paramsEnd = entry.indexOf(')');
+    String name = entry.substring(0, paramsStart);
+
+    String paramSignature = entry.substring(paramsStart + 1, paramsEnd);
+    Class<?>[] params = new Class<?>[paramSignature.length()];
+    for (int j = 0; j < params.length; ++j) {
+      params[j] = primitiveClass(paramSignature.charAt(j));
+      if (params[j] == null) {
+        return null;
+      }
+    }
+
+    Method method = findMethod(clazz, name, params);
+    if (method == null) {
+      return null;
+    }
+
+    try {
+      return new Op(method);
+    } catch (ReflectiveOperationException e) {
+      return null;
+    }
+  }
+
+  private static Method findMethod(Class<?> clazz, String name, Class<?>[] params) {
+    for (Class<?> c = clazz; c != null; c = c.getSuperclass()) {
+      try {
+        Method method = c.getDeclaredMethod(name, params);
+        method.setAccessible(true);
+        return method;
+      } catch (NoSuchMethodException e) {
+        // Keep searching superclasses.
+      }
+    }
+
+    try {
+      return clazz.getMethod(name, params);
+    } catch (NoSuchMethodException e) {
+      return null;
+    }
+  }
+
+  private static Class<?> primitiveClass(char signatureChar) {
+    switch (signatureChar) {
+      case 'Z':
+        return boolean.class;
+      case 'B':
+        return byte.class;
+      case 'C':
+        return char.class;
+      case 'S':
+        return short.class;
+      case 'I':
+        return int.class;
+      case 'J':
+        return long.class;
+      case 'F':
+        return float.class;
+      case 'D':
+        return double.class;
+      default:
+        return null;
+    }
+  }
+
+  private static int sizeOf(Class<?> type) {
+    if (type == boolean.class || type == byte.class) {
+      return 1;
+    } else if (type == char.class || type == short.class) {
+      return 2;
+    } else if (type == int.class || type == float.class) {
+      return 4;
+    }
+    return 8;
+  }
+
+  /** The suffix of the {@link ByteBuffer} accessors for {@code type}, e.g. "Int" for getInt. */
+  private static String accessorSuffix(Class<?> type) {
+    if (type == byte.class) {
+      return "";
+    }
+    String name = type.getName();
+    return Character.toUpperCase(name.charAt(0)) + name.substring(1);
+  }
+
+  /** (ByteBuffer, int position)type, reading at position + offset. */
+  private static MethodHandle reader(Class<?> type, int offset)
+      throws ReflectiveOperationException {
+    MethodHandle get =
+        type == boolean.class
+            ? GET_BOOLEAN
+            : LOOKUP.findVirtual(
+                ByteBuffer.class, "get" + accessorSuffix(type), methodType(type, int.class));
+
+    return MethodHandles.filterArguments(get, 1, MethodHandles.insertArguments(ADD, 1, offset));
+  }
+
+  /** (ByteBuffer, int position, type)void. */
+  private static MethodHandle writer(Class<?> type) throws ReflectiveOperationException {
+    if (type == boolean.class) {
+      return PUT_BOOLEAN;
+    }
+
+    MethodHandle put =
+        LOOKUP.findVirtual(
+            ByteBuffer.class,
+            "put" + accessorSuffix(type),
+            methodType(ByteBuffer.class, int.class, type));
+    return put.asType(put.type().changeReturnType(void.class));
+  }
+
+  private static int add(int position, int offset) {
+    return position + offset;
+  }
+
+  private static boolean getBoolean(ByteBuffer buffer, int position) {
+    return buffer.get(position) != 0;
+  }
+
+  private static void putBoolean(ByteBuffer buffer, int position, boolean value) {
+    buffer.put(position, (byte) (value ? 1 : 0));
+  }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.jnibind.test;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.AfterClass;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+import org.junit.runners.JUnit4;
+
+/**
+ * Times builder setter chains made from native, either one JNI transition per call ({@code Call})
+ * or one per chain ({@code jni::Batch} and {@code com.jnibind.BatchExecutor}), and reports the two
+ * side by side.
+ */
+@RunWith(JUnit4.class)
+public final class BatchBenchmark {
+  private static final int WARMUP_ITERATIONS = 10_000;
+  private static final int ITERATIONS = 200_000;
+
+  static {
+    System.load(
+        System.getenv("JAVA_RUNFILES")
+            + "/_main/javatests/com/jnibind/test/libbatch_benchmark_jni.so");
+  }
+
+  static native void jniTearDown();
+
+  // Returns the elapsed nanoseconds for |iterations| chains of |setters| calls.
+  static native long nativeSetters(
+      Builder builder, int iterations, int setters, boolean batched);
+
+  @AfterClass
+  public static void doShutDown() {
+    jniTearDown();
+  }
+
+  /** Mirrors the builder of BuilderTest. */
+  static final class Builder {
+    int valOne;
+    int valTwo;
+    int valThree;
+
+    Builder setOne(int val) {
+      valOne = val;
+      return this;
+    }
+
+    Builder setTwo(int val) {
+      valTwo = val;
+      return this;
+    }
+
+    Builder setThree(int val) {
+      valThree = val;
+      return this;
+    }
+  }
+
+  private static void benchmark(int setters) {
+    Builder builder = new Builder();
+    nativeSetters(builder, WARMUP_ITERATIONS, setters, false);
+    nativeSetters(builder, WARMUP_ITERATIONS, setters, true);
+
+    long callNanos = nativeSetters(builder, ITERATIONS, setters, false);
+    long batchNanos = nativeSetters(builder, ITERATIONS, setters, true);
+    assertThat(callNanos).isGreaterThan(0);
+    assertThat(batchNanos).isGreaterThan(0);
+
+    System.out.printf(
+        "%d setters: Call %.1f ns/chain, Batch %.1f ns/chain (%.2fx)%n",
+        setters,
+        (double) callNanos / ITERATIONS,
+        (double) batchNanos / ITERATIONS,
+        (double) callNanos / batchNanos);
+  }
+
+  @Test
+  public void benchmarkThreeSetters() {
+    benchmark(3);
+  }
+
+  @Test
+  public void benchmarkTwelveSetters() {
+    benchmark(12);
+  }
+}
@@ -73,8 +73,15 @@ public class BuilderTest {
 
   native ObjectTestHelper useBuilderToCreateObject();
 
+  native ObjectTestHelper useBatchedBuilderToCreateObject();
+
   @Test
   public void constructsExpectedObjectWithSimpleBuilder() {
     assertTrue(useBuilderToCreateObject().isEqualTo(new ObjectTestHelper(111, 222, 333)));
   }
+
+  @Test
+  public void constructsExpectedObjectWithBatchedBuilder() {
+    assertTrue(useBatchedBuilderToCreateObject().isEqualTo(new ObjectTestHelper(111, 222, 333)));
+  }
 }
@@ -61,4 +61,17 @@ public final class ExceptionTest {
             });
     assertThat(exception).hasMessageThat().isEqualTo("Built Exception");
   }
+
+  native void jniThrowNewCustomException();
+
+  @Test
+  public void testJniThrowNewCustomException() {
+    CustomException exception =
+        assertThrows(
+            CustomException.class,
+            () -> {
+              jniThrowNewCustomException();
+            });
+    assertThat(exception).hasMessageThat().isEqualTo("ThrowNew failure message");
+  }
 }
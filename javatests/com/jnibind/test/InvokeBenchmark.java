@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.jnibind.test;
+
+import static com.google.common.truth.Truth.assertThat;
+
+import org.junit.AfterClass;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+import org.junit.runners.JUnit4;
+
+/**
+ * Times native to Java calls with 0, 4 and 12 arguments, and constructions with 4 arguments, made
+ * both with varargs (Call*MethodV and NewObjectV) and with jvalue arrays (Call*MethodA and
+ * NewObjectA), and reports the two side by side.
+ */
+@RunWith(JUnit4.class)
+public final class InvokeBenchmark {
+  private static final int WARMUP_ITERATIONS = 10_000;
+  private static final int ITERATIONS = 1_000_000;
+
+  static {
+    System.load(
+        System.getenv("JAVA_RUNFILES")
+            + "/_main/javatests/com/jnibind/test/libinvoke_benchmark_jni.so");
+  }
+
+  static native void jniTearDown();
+
+  // Each returns the elapsed nanoseconds for |iterations| calls.
+  native long nativeZeroArgs(int iterations, boolean useJvalues);
+
+  native long nativeFourArgs(int iterations, boolean useJvalues);
+
+  native long nativeTwelveArgs(int iterations, boolean useJvalues);
+
+  native long nativeConstructFourArgs(int iterations, boolean useJvalues);
+
+  private int sink;
+
+  @AfterClass
+  public static void doShutDown() {
+    jniTearDown();
+  }
+
+  int zeroArgs() {
+    return sink++;
+  }
+
+  int fourArgs(int a, long b, float c, double d) {
+    return sink += a + (int) b + (int) c + (int) d;
+  }
+
+  int twelveArgs(
+      int a, long b, float c, double d, int e, long f, float g, double h, int i, long j, float k,
+      double l) {
+    return sink +=
+        a + (int) b + (int) c + (int) d + e + (int) f + (int) g + (int) h + i + (int) j + (int) k
+            + (int) l;
+  }
+
+  /** Constructed from native, through NewObjectV or NewObjectA. */
+  static final class Constructed {
+    final int sum;
+
+    Constructed(int a, long b, float c, double d) {
+      sum = a + (int) b + (int) c + (int) d;
+    }
+  }
+
+  /** A benchmark body, run once with varargs and once with jvalue arrays. */
+  private interface Timed {
+    long run(int iterations, boolean useJvalues);
+  }
+
+  private static void benchmark(String name, Timed timed) {
+    timed.run(WARMUP_ITERATIONS, false);
+    timed.run(WARMUP_ITERATIONS, true);
+
+    long varargsNanos = timed.run(ITERATIONS, false);
+    long jvalueNanos = timed.run(ITERATIONS, true);
+    assertThat(varargsNanos).isGreaterThan(0);
+    assertThat(jvalueNanos).isGreaterThan(0);
+
+    System.out.printf(
+        "%s: varargs %.1f ns/call, jvalue %.1f ns/call (%.2fx)%n",
+        name,
+        (double) varargsNanos / ITERATIONS,
+        (double) jvalueNanos / ITERATIONS,
+        (double) varargsNanos / jvalueNanos);
+  }
+
+  @Test
+  public void benchmarkZeroArgs() {
+    benchmark("zeroArgs", this::nativeZeroArgs);
+  }
+
+  @Test
+  public void benchmarkFourArgs() {
+    benchmark("fourArgs", this::nativeFourArgs);
+  }
+
+  @Test
+  public void benchmarkTwelveArgs() {
+    benchmark("twelveArgs", this::nativeTwelveArgs);
+  }
+
+  @Test
+  public void benchmarkConstructFourArgs() {
+    benchmark("constructFourArgs", this::nativeConstructFourArgs);
+  }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <memory>
+
+#include "jni_bind.h"
+
+using ::jni::Batch;
+using ::jni::Class;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+using ::jni::Self;
+
+static std::unique_ptr<jni::JvmRef<jni::kDefaultJvm>> jvm;
+
+// clang-format off
+constexpr Class kBuilder {
+    "com/jnibind/test/BatchBenchmark$Builder",
+
+    Method{"setOne", Return{Self{}}, Params<jint>{}},
+    Method{"setTwo", Return{Self{}}, Params<jint>{}},
+    Method{"setThree", Return{Self{}}, Params<jint>{}},
+};
+// clang-format on
+
+namespace {
+
+template <typename Func>
+jlong TimeIterations(jint iterations, Func&& func) {
+  auto start = std::chrono::steady_clock::now();
+  for (jint i = 0; i < iterations; ++i) {
+    func(i);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+}  // namespace
+
+extern "C" {
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* pjvm, void* reserved) {
+  jvm.reset(new jni::JvmRef<jni::kDefaultJvm>(pjvm));
+  return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL
+Java_com_jnibind_test_BatchBenchmark_jniTearDown(JNIEnv* env, jclass) {
+  jvm = nullptr;
+}
+
+// Returns the elapsed nanoseconds for `iterations` rounds of `setters` calls
+// (setOne, setTwo, setThree, repeated) on `builder`. If `batched`, each round
+// is recorded into a reused `Batch` and executed in one transition, otherwise
+// every call is made through `Call`.
+JNIEXPORT jlong JNICALL Java_com_jnibind_test_BatchBenchmark_nativeSetters(
+    JNIEnv* env, jclass, jobject builder_object, jint iterations, jint setters,
+    jboolean batched) {
+  LocalObject<kBuilder> builder{builder_object};
+
+  if (batched) {
+    Batch<kBuilder> batch;
+
+    return TimeIterations(iterations, [&](jint i) {
+      batch.Clear();
+      for (jint j = 0; j < setters; j += 3) {
+        batch.Call<"setOne">(i).Call<"setTwo">(j).Call<"setThree">(i + j);
+      }
+      batch.Execute(builder);
+    });
+  }
+
+  return TimeIterations(iterations, [&](jint i) {
+    for (jint j = 0; j < setters; j += 3) {
+      builder.Call<"setOne">(i);
+      builder.Call<"setTwo">(j);
+      builder.Call<"setThree">(i + j);
+    }
+  });
+}
+
+}  // extern "C"
@@ -22,6 +22,7 @@
 #define JNI_MTHD(x, y, ...) \
   x Java_com_jnibind_test_BuilderTest_##y(JNIEnv*, jclass, ##__VA_ARGS__)
 
+using ::jni::Batch;
 using ::jni::Class;
 using ::jni::Constructor;
 using ::jni::LocalObject;
@@ -64,4 +65,14 @@ JNI_MTHD(jobject, useBuilderToCreateObject) {
       .Release();
 }
 
+JNI_MTHD(jobject, useBatchedBuilderToCreateObject) {
+  LocalObject<kBuilder> builder{};
+
+  Batch<kBuilder> batch;
+  batch.Call<"setOne">(111).Call<"setTwo">(222).Call<"setThree">(333);
+  batch.Execute(builder);
+
+  return builder.Call<"build">().Release();
+}
+
 }  // extern "C"
@@ -55,4 +55,10 @@ Java_com_jnibind_test_ExceptionTest_jniThrowExceptionFromStaticMethod(
   exception.Throw();
 }
 
+JNIEXPORT void JNICALL
+Java_com_jnibind_test_ExceptionTest_jniThrowNewCustomException(JNIEnv* env,
+                                                               jobject) {
+  jni::ThrowNew<kCustomException>("ThrowNew failure message");
+}
+
 }  // extern "C"
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <chrono>
+#include <memory>
+
+#include "jni_bind.h"
+
+using ::jni::Class;
+using ::jni::Constructor;
+using ::jni::ConstructWithJvalues;
+using ::jni::LocalObject;
+using ::jni::Method;
+using ::jni::Params;
+using ::jni::Return;
+
+static std::unique_ptr<jni::JvmRef<jni::kDefaultJvm>> jvm;
+
+// clang-format off
+constexpr Class kInvokeBenchmark {
+    "com/jnibind/test/InvokeBenchmark",
+
+    Method{"zeroArgs", Return<jint>{}, Params<>{}},
+    Method{"fourArgs", Return<jint>{}, Params<jint, jlong, jfloat, jdouble>{}},
+    Method{"twelveArgs", Return<jint>{}, Params<
+        jint, jlong, jfloat, jdouble,
+        jint, jlong, jfloat, jdouble,
+        jint, jlong, jfloat, jdouble>{}},
+};
+
+constexpr Class kConstructed {
+    "com/jnibind/test/InvokeBenchmark$Constructed",
+
+    Constructor<jint, jlong, jfloat, jdouble>{},
+};
+// clang-format on
+
+namespace {
+
+template <typename Func>
+jlong TimeIterations(jint iterations, Func&& func) {
+  auto start = std::chrono::steady_clock::now();
+  for (jint i = 0; i < iterations; ++i) {
+    func(i);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+}  // namespace
+
+extern "C" {
+
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* pjvm, void* reserved) {
+  jvm.reset(new jni::JvmRef<jni::kDefaultJvm>(pjvm));
+  return JNI_VERSION_1_6;
+}
+
+JNIEXPORT void JNICALL
+Java_com_jnibind_test_InvokeBenchmark_jniTearDown(JNIEnv* env, jclass) {
+  jvm = nullptr;
+}
+
+// Each returns the elapsed nanoseconds for `iterations` calls, made through
+// `CallA` (`Call<Type>MethodA`) if `use_jvalues`, else `Call` (varargs).
+// Constructions likewise use `ConstructWithJvalues` (`NewObjectA`).
+JNIEXPORT jlong JNICALL Java_com_jnibind_test_InvokeBenchmark_nativeZeroArgs(
+    JNIEnv* env, jobject object, jint iterations, jboolean use_jvalues) {
+  LocalObject<kInvokeBenchmark> benchmark{object};
+
+  if (use_jvalues) {
+    return TimeIterations(iterations,
+                          [&](jint) { benchmark.CallA<"zeroArgs">(); });
+  }
+
+  return TimeIterations(iterations,
+                        [&](jint) { benchmark.Call<"zeroArgs">(); });
+}
+
+JNIEXPORT jlong JNICALL Java_com_jnibind_test_InvokeBenchmark_nativeFourArgs(
+    JNIEnv* env, jobject object, jint iterations, jboolean use_jvalues) {
+  LocalObject<kInvokeBenchmark> benchmark{object};
+
+  if (use_jvalues) {
+    return TimeIterations(iterations, [&](jint i) {
+      benchmark.CallA<"fourArgs">(i, jlong{i}, 1.f, 2.);
+    });
+  }
+
+  return TimeIterations(iterations, [&](jint i) {
+    benchmark.Call<"fourArgs">(i, jlong{i}, 1.f, 2.);
+  });
+}
+
+JNIEXPORT jlong JNICALL Java_com_jnibind_test_InvokeBenchmark_nativeTwelveArgs(
+    JNIEnv* env, jobject object, jint iterations, jboolean use_jvalues) {
+  LocalObject<kInvokeBenchmark> benchmark{object};
+
+  if (use_jvalues) {
+    return TimeIterations(iterations, [&](jint i) {
+      benchmark.CallA<"twelveArgs">(i, jlong{i}, 1.f, 2., i, jlong{i}, 1.f, 2.,
+                                    i, jlong{i}, 1.f, 2.);
+    });
+  }
+
+  return TimeIterations(iterations, [&](jint i) {
+    benchmark.Call<"twelveArgs">(i, jlong{i}, 1.f, 2., i, jlong{i}, 1.f, 2., i,
+                                 jlong{i}, 1.f, 2.);
+  });
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_jnibind_test_InvokeBenchmark_nativeConstructFourArgs(
+    JNIEnv* env, jobject object, jint iterations, jboolean use_jvalues) {
+  if (use_jvalues) {
+    return TimeIterations(iterations, [&](jint i) {
+      LocalObject<kConstructed>{ConstructWithJvalues{}, i, jlong{i}, 1.f, 2.};
+    });
+  }
+
+  return TimeIterations(iterations, [&](jint i) {
+    LocalObject<kConstructed>{i, jlong{i}, 1.f, 2.};
+  });
+}
+
+}  // extern "C"
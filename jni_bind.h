@@ -56,6 +56,7 @@ static constexpr Configuration kConfig{
 #include "implementation/array.h"
 #include "implementation/array_type_conversion.h"
 #include "implementation/class.h"
+#include "implementation/class_keyed_map.h"
 #include "implementation/class_loader.h"
 #include "implementation/constructor.h"
 #include "implementation/default_class_loader.h"
@@ -68,6 +69,7 @@ static constexpr Configuration kConfig{
 #include "implementation/jvm.h"
 #include "implementation/loaded_by.h"
 #include "implementation/method.h"
+#include "implementation/method_ancestry.h"
 #include "implementation/no_idx.h"
 #include "implementation/params.h"
 #include "implementation/proxy_convenience_aliases.h"
@@ -87,15 +89,28 @@ static constexpr Configuration kConfig{
 #include "class_defs/java_lang_classes.h"
 #include "class_defs/java_lang_exception.h"
 #include "class_defs/java_lang_throwable.h"
+#include "class_defs/java_nio_classes.h"
 #include "class_defs/java_util_array_list.h"
 #include "class_defs/java_util_classes.h"
 
 // Headers for dynamic definitions.
 #include "implementation/array_view.h"
+#include "implementation/batch.h"
+#include "implementation/bound_field.h"
+#include "implementation/bound_method.h"
+#include "implementation/call_checked.h"
+#include "implementation/construct_all.h"
+#include "implementation/critical_array_view.h"
+#include "implementation/direct_byte_buffer.h"
+#include "implementation/expected.h"
+#include "implementation/find_class_fallback_cache.h"
 #include "implementation/global_class_loader.h"
 #include "implementation/global_exception.h"
 #include "implementation/global_object.h"
 #include "implementation/global_string.h"
+#include "implementation/id_cache_report.h"
+#include "implementation/instance_of.h"
+#include "implementation/invoke_all.h"
 #include "implementation/jvm_ref.h"
 #include "implementation/local_array.h"
 #include "implementation/local_array_string.h"
@@ -103,9 +118,13 @@ static constexpr Configuration kConfig{
 #include "implementation/local_exception.h"
 #include "implementation/local_object.h"
 #include "implementation/local_string.h"
+#include "implementation/native_methods.h"
+#include "implementation/prewarm.h"
 #include "implementation/promotion_mechanics.h"
 #include "implementation/promotion_mechanics_tags.h"
 #include "implementation/ref_base.h"
+#include "implementation/startup_profile.h"
+#include "implementation/tracked_array_view.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Phase 1 Compilation: JNI Bind definitions permissible.
@@ -18,7 +18,9 @@
 #define JNI_BIND_METAPROGRAMMING_DOUBLE_LOCKED_VALUE_H_
 
 #include <atomic>
-#include <mutex>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
 
 namespace jni::metaprogramming {
 
@@ -27,56 +29,130 @@ namespace jni::metaprogramming {
 // subsequent loads will be thread safe, invoking the lambda once (and only
 // once) if the currently stored value is T{0}.
 //
+// Values may also be tagged with a `generation`. A load with a generation
+// other than the one the value was stored with treats the value as stale and
+// re-initialises it, so a whole population of instances can be invalidated by
+// advancing a single counter rather than by resetting each of them.
+//
 // This class is thread-safe.  Loads will be cheap (after a potentially
 // expensive initial init), stores are expensive.
+//
+// Rather than a `std::mutex`, initialisation and reset are guarded by a one
+// byte flag that waiters block on with `std::atomic_flag::wait` (a futex on
+// Linux) where available, so an instance for a pointer `T_` is 16 bytes.
+// Like a mutex, the flag is per instance, so the lambda may itself initialise
+// other instances.
 template <typename T_>
 class DoubleLockedValue {
  public:
   template <typename Lambda>
-  T_ LoadAndMaybeInit(Lambda lambda) {
+  T_ LoadAndMaybeInit(Lambda lambda, std::uint32_t generation = 0) {
     // Typical case, value already initialised, perform cheap load and return.
+    // The generation is loaded first so the value is at least as new as it.
+    bool is_current = generation_.load(std::memory_order_acquire) == generation;
     T_ return_value = value_.load(std::memory_order_acquire);
 
-    if (return_value != T_{0}) {
+    if (is_current && return_value != T_{0}) {
       return return_value;
     }
 
-    // Value was nil (uninitialised), perform heavy-weight lock.
-    std::lock_guard<std::mutex> lock_guard{lock_};
+    // Value was nil (uninitialised) or stale, perform heavy-weight lock.
+    Lock();
 
     // Check another thread didn't race to lock before.
-    return_value = value_.load(std::memory_order_acquire);
-    if (return_value != T_{}) {
+    return_value = value_.load(std::memory_order_relaxed);
+    if (generation_.load(std::memory_order_relaxed) == generation &&
+        return_value != T_{}) {
+      Unlock();
       return return_value;
     }
 
     // Perform the potentially expensive initialisation and return.
+    const bool was_live =
+        IsLive(return_value, generation_.load(std::memory_order_relaxed));
     return_value = lambda();
-    value_.store(return_value, std::memory_order_release);
+    value_.store(return_value, std::memory_order_relaxed);
+    generation_.store(generation, std::memory_order_release);
+    UpdateLiveCount(was_live, IsLive(return_value, generation));
+
+    Unlock();
     return return_value;
   }
 
   // Sets the value to {0}.
   void Reset() {
-    std::lock_guard<std::mutex> lock_guard{lock_};
-    value_.store(0, std::memory_order_release);
+    Lock();
+    UpdateLiveCount(IsLive(value_.exchange(0, std::memory_order_acq_rel),
+                           generation_.load(std::memory_order_relaxed)),
+                    false);
+    Unlock();
   }
 
   // Sets the value to {0} and iff the value was not {0} prior to being torn
   // down, the teardown lambda will be invoked with this value.
   template <typename TeardownLambda>
   void Reset(TeardownLambda lambda) {
-    std::lock_guard<std::mutex> lock_guard{lock_};
+    Lock();
     auto val = value_.load();
     if (val != 0) {
       lambda(val);
       value_.store(0, std::memory_order_release);
+      UpdateLiveCount(
+          IsLive(val, generation_.load(std::memory_order_relaxed)), false);
     }
+    Unlock();
+  }
+
+  // The number of instances (of this `T_`) currently holding a value stored
+  // against the live generation (see `SetLiveGeneration`).
+  static std::size_t LiveCount() {
+    return live_count_.load(std::memory_order_relaxed);
+  }
+
+  // Called when `generation` supersedes every other generation of this `T_`,
+  // whose values are now stale and so no longer counted by `LiveCount`.
+  static void SetLiveGeneration(std::uint32_t generation) {
+    live_generation_.store(generation, std::memory_order_relaxed);
+    live_count_.store(0, std::memory_order_relaxed);
   }
 
  private:
+  static bool IsLive(T_ value, std::uint32_t generation) {
+    return value != T_{0} &&
+           generation == live_generation_.load(std::memory_order_relaxed);
+  }
+
+  static void UpdateLiveCount(bool was_live, bool is_live) {
+    if (!was_live && is_live) {
+      live_count_.fetch_add(1, std::memory_order_relaxed);
+    } else if (was_live && !is_live) {
+      live_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  void Lock() {
+    while (lock_.test_and_set(std::memory_order_acquire)) {
+#if __cpp_lib_atomic_wait
+      lock_.wait(true, std::memory_order_relaxed);
+#else
+      std::this_thread::yield();
+#endif  // __cpp_lib_atomic_wait
+    }
+  }
+
+  void Unlock() {
+    lock_.clear(std::memory_order_release);
+#if __cpp_lib_atomic_wait
+    lock_.notify_all();
+#endif  // __cpp_lib_atomic_wait
+  }
+
   std::atomic<T_> value_ = {0};
-  std::mutex lock_;
+  std::atomic<std::uint32_t> generation_ = {0};
+  std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+
+  static inline std::atomic<std::size_t> live_count_ = 0;
+  static inline std::atomic<std::uint32_t> live_generation_ = 0;
 };
 
 }  // namespace jni::metaprogramming
@@ -16,6 +16,10 @@
 
 #include "double_locked_value.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 namespace {
@@ -94,4 +98,85 @@ TEST(DoubleLockedValue, MixesResetWithAndWithoutLambda) {
   double_locked_value.Reset([](int teardown_val) { FAIL(); });
 }
 
+TEST(DoubleLockedValue, ReinitialisesOnlyWhenGenerationChanges) {
+  int a = 1;
+  auto lambda{[&]() { return a++; }};
+  DoubleLockedValue<int> double_locked_value;
+  EXPECT_EQ(1, double_locked_value.LoadAndMaybeInit(lambda, 7));
+  EXPECT_EQ(1, double_locked_value.LoadAndMaybeInit(lambda, 7));
+  EXPECT_EQ(2, double_locked_value.LoadAndMaybeInit(lambda, 8));
+  EXPECT_EQ(2, double_locked_value.LoadAndMaybeInit(lambda, 8));
+  EXPECT_EQ(3, double_locked_value.LoadAndMaybeInit(lambda, 7));
+}
+
+TEST(DoubleLockedValue, InitialisesOnceAcrossThreads) {
+  std::atomic<int> num_inits = 0;
+  DoubleLockedValue<int> double_locked_value;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&]() {
+      EXPECT_EQ(123, double_locked_value.LoadAndMaybeInit([&]() {
+        ++num_inits;
+        return 123;
+      }));
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(num_inits, 1);
+}
+
+TEST(DoubleLockedValue, AllowsInitialisingOtherValuesFromLambda) {
+  DoubleLockedValue<int> outer;
+  DoubleLockedValue<int> inner;
+
+  EXPECT_EQ(3, outer.LoadAndMaybeInit([&]() {
+    return inner.LoadAndMaybeInit([]() { return 2; }) + 1;
+  }));
+}
+
+TEST(DoubleLockedValue, TracksLiveCount) {
+  DoubleLockedValue<long> double_locked_value;
+  const std::size_t base = DoubleLockedValue<long>::LiveCount();
+
+  double_locked_value.LoadAndMaybeInit([]() { return 0l; });
+  EXPECT_EQ(DoubleLockedValue<long>::LiveCount(), base);
+  double_locked_value.LoadAndMaybeInit([]() { return 1l; });
+  EXPECT_EQ(DoubleLockedValue<long>::LiveCount(), base + 1);
+  double_locked_value.Reset();
+  EXPECT_EQ(DoubleLockedValue<long>::LiveCount(), base);
+  double_locked_value.LoadAndMaybeInit([]() { return 2l; });
+  double_locked_value.Reset([](long) {});
+  EXPECT_EQ(DoubleLockedValue<long>::LiveCount(), base);
+}
+
+TEST(DoubleLockedValue, OnlyCountsValuesOfTheLiveGeneration) {
+  DoubleLockedValue<short> first;
+  DoubleLockedValue<short> second;
+
+  first.LoadAndMaybeInit([]() { return short{1}; }, 0);
+  second.LoadAndMaybeInit([]() { return short{1}; }, 0);
+  EXPECT_EQ(DoubleLockedValue<short>::LiveCount(), 2);
+
+  // Both values are now stale.
+  DoubleLockedValue<short>::SetLiveGeneration(1);
+  EXPECT_EQ(DoubleLockedValue<short>::LiveCount(), 0);
+
+  first.LoadAndMaybeInit([]() { return short{2}; }, 1);
+  EXPECT_EQ(DoubleLockedValue<short>::LiveCount(), 1);
+
+  // Resetting a stale value doesn't affect the count.
+  second.Reset();
+  EXPECT_EQ(DoubleLockedValue<short>::LiveCount(), 1);
+  first.Reset();
+  EXPECT_EQ(DoubleLockedValue<short>::LiveCount(), 0);
+}
+
+TEST(DoubleLockedValue, IsTwiceTheSizeOfItsValue) {
+  EXPECT_EQ(sizeof(DoubleLockedValue<void*>), 2 * sizeof(void*));
+}
+
 }  // namespace